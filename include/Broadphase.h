@@ -0,0 +1,77 @@
+#ifndef BROADPHASE_H
+#define BROADPHASE_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include <unordered_map>
+#include <utility>
+
+// Layer untuk entity dinamis
+enum BroadphaseLayer {
+    BP_PLAYER = 0,
+    BP_ENEMY,
+    BP_COIN,
+    BP_TEXT,
+    BP_LAYER_COUNT
+};
+
+inline Uint32 bpMask(int layer) { return 1u << layer; }
+
+struct BroadphaseProxy {
+    SDL_Rect box;
+    int cell0, cell1;   // Range cell X yang ditempati (inklusif)
+    int layer;
+    int user;           // EntityHandle milik entity (lihat EntityStore.h)
+    bool alive;
+};
+
+// Uniform grid di sumbu X untuk entity yang bergerak.
+// Level kita lebar tapi pendek, jadi cukup dibagi per kolom.
+// Update bersifat incremental: move() hanya menyentuh bucket
+// kalau range cell proxy berubah.
+class Broadphase {
+public:
+    explicit Broadphase(int cellWidth = 128);
+
+    void clear();
+
+    int add(const SDL_Rect& box, int layer, int user);
+    void move(int id, const SDL_Rect& box);
+    void remove(int id);
+    void setUser(int id, int user);
+
+    // Bucket cell di range pixel [x0, x1) disiapkan saat chunk di-stream,
+    // supaya add/move selama gameplay tidak mengalokasi. Bucket kosong
+    // baru dilepas lewat releaseCells saat chunk-nya di-evict.
+    void reserveCells(int x0, int x1);
+    void releaseCells(int x0, int x1);
+
+    int cellSize() const { return cellWidth; }
+    const BroadphaseProxy& proxy(int id) const { return proxies[id]; }
+    int proxyCount() const { return static_cast<int>(proxies.size() - freeIds.size()); }
+
+    // Proxy (dari layer di mask) yang box-nya overlap dengan area
+    void query(const SDL_Rect& area, Uint32 layerMask, std::vector<int>& out) const;
+
+    // Pasangan proxy yang overlap antara dua layer (boleh layer yang sama)
+    void findPairs(int layerA, int layerB, std::vector<std::pair<int, int> >& out) const;
+
+private:
+    static const size_t BUCKET_RESERVE = 8;
+
+    int cellWidth;
+    std::vector<BroadphaseProxy> proxies;
+    std::vector<int> freeIds;
+    std::unordered_map<int, std::vector<int> > cells;
+
+    // Dedup untuk proxy yang menempati lebih dari satu cell
+    mutable std::vector<Uint32> stamps;
+    mutable Uint32 currentStamp;
+    mutable std::vector<int> pairScratch;
+
+    int cellOf(int x) const;
+    void insertCells(int id);
+    void removeCells(int id);
+};
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef CHUNKSOURCE_H
+#define CHUNKSOURCE_H
+
+#include "GameBox.h"
+#include "LevelFile.h"
+#include "TileMap.h"
+#include <vector>
+
+// Sumber isi chunk untuk World. Chunk selalu dibangun "bersih" dari
+// data level; state permanen (block sudah dipukul, coin sudah diambil,
+// enemy sudah mati) diterapkan oleh World setelahnya.
+class ChunkSource {
+public:
+    virtual ~ChunkSource() {}
+
+    virtual int rows() const = 0;
+    virtual int tileSize() const = 0;
+    virtual int groundHeight() const = 0;
+    virtual int widthPixels() const = 0;    // -1 = level tanpa ujung
+    virtual void playerStart(float& x, float& y) const = 0;
+
+    // Isi chunk ke-index. Return false kalau datanya belum siap,
+    // World akan mencoba lagi di frame berikutnya.
+    virtual bool buildChunk(int index, int chunkCols, LevelChunk& chunk) = 0;
+
+    // spawnId terkecil yang bisa muncul di chunk ke-index dan setelahnya,
+    // untuk level tanpa ujung yang spawnId-nya naik mengikuti x.
+    // -1 = tidak diketahui (state spawn tidak pernah dibuang).
+    virtual int spawnIdFloor(int) const { return -1; }
+};
+
+// Chunk dari level .lvl (mmap atau image built-in)
+class LevelChunkSource : public ChunkSource {
+public:
+    explicit LevelChunkSource(const LevelView& level);
+
+    int rows() const { return tileMap.rows(); }
+    int tileSize() const { return tileMap.tileSize(); }
+    int groundHeight() const { return level.groundHeight(); }
+    int widthPixels() const { return tileMap.widthPixels(); }
+    void playerStart(float& x, float& y) const;
+
+    bool buildChunk(int index, int chunkCols, LevelChunk& chunk);
+
+    const TileMap& tiles() const { return tileMap; }
+
+private:
+    LevelView level;
+    TileMap tileMap;
+    std::vector<int> colliderScratch;
+};
+
+// Kosongkan chunk tanpa melepas kapasitas vector (slot dipakai ulang)
+void resetChunk(LevelChunk& chunk, int index, int startX, int cols, int rows, int tileSize);
+
+// Isi colliderGrid chunk dari daftar platforms
+void indexChunkColliders(LevelChunk& chunk, int tileSize);
+
+// Entity baru dari spawn table level, digeser offsetX pixel
+Coin makeCoin(const LevelCoinSpawn& spawn, int offsetX, int spawnId);
+Enemy makeEnemy(const LevelEnemySpawn& spawn, int offsetX, int spawnId);
+
+#endif
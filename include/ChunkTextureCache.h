@@ -0,0 +1,66 @@
+#ifndef CHUNKTEXTURECACHE_H
+#define CHUNKTEXTURECACHE_H
+
+#include "World.h"
+#include "RenderQueue.h"
+#include <SDL2/SDL.h>
+#include <vector>
+
+struct ChunkRenderStats {
+    int visibleChunks;
+    int textureCopies;      // Copy texture untuk layer tile
+    int redrawnChunks;      // Chunk yang digambar ulang ke texture frame ini
+    int directTiles;        // Tile yang digambar langsung (fallback tanpa render target)
+};
+
+// Layer tile statis, digambar sekali per chunk ke render target.
+// Frame biasa cukup satu copy texture per chunk yang terlihat; chunk
+// digambar ulang hanya kalau revision-nya berubah (chunk baru dibangun,
+// '?' dipukul, hot reload). Texture chunk yang sudah tidak resident
+// dipakai ulang untuk chunk lain begitu keluar dari layar.
+class ChunkTextureCache {
+public:
+    explicit ChunkTextureCache(SDL_Renderer* renderer);
+    ~ChunkTextureCache();
+
+    // Copy texture chunk yang terlihat ke queue di layer (dan layer + 1
+    // untuk fallback tanpa render target). Membaca salinan tile dari
+    // snapshot, bukan World, jadi aman di thread render.
+    void draw(RenderQueue& queue, int layer, const TileView& tiles, float cameraX, int viewWidth);
+
+    // Isi texture hilang (SDL_RENDER_TARGETS_RESET) - gambar ulang semua
+    void invalidate();
+
+    const ChunkRenderStats& stats() const { return frameStats; }
+
+private:
+    struct Entry {
+        int chunkIndex;     // -1 = texture bebas
+        Uint32 revision;
+        SDL_Texture* texture;
+    };
+
+    SDL_Renderer* renderer;
+    const World* owner;
+    bool targetsSupported;
+    int textureWidth;
+    int textureHeight;
+    std::vector<Entry> entries;
+    RenderQueue redrawQueue;    // Batch tile saat menggambar ke texture
+    ChunkRenderStats frameStats;
+
+    void destroyTextures();
+    Entry* entryFor(int chunkIndex);
+    void releaseStale(const TileView& tiles);
+    void redraw(Entry& entry, const LevelChunk& chunk, int groundY, int tileSize);
+
+    ChunkTextureCache(const ChunkTextureCache&);
+    ChunkTextureCache& operator=(const ChunkTextureCache&);
+};
+
+// Submit tile chunk di kolom [col0, col1], dengan kolom 0 di offsetX.
+// Isi block di layer, outline dan tanda '?' di layer + 1.
+void drawChunkTiles(RenderQueue& queue, int layer, const LevelChunk& chunk, int col0, int col1,
+                    int offsetX, int groundY, int tileSize);
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef EDITABLELEVEL_H
+#define EDITABLELEVEL_H
+
+#include "ChunkSource.h"
+#include "LevelParse.h"
+#include <map>
+#include <string>
+#include <vector>
+
+// Level teks (legend sama dengan levels/*.txt) yang bisa di-reload
+// saat game jalan. Reload hanya mem-patch cell yang berubah; collider
+// di-merge per chunk saat chunk dibangun, jadi edit kecil tidak perlu
+// menghitung ulang seluruh level.
+class EditableLevelSource : public ChunkSource {
+public:
+    explicit EditableLevelSource(int tileSize);
+
+    bool load(const std::string& path, std::string& error);
+
+    // Baca ulang file dan patch cell yang berubah. Range pixel yang
+    // berubah dikembalikan di [dirtyX0, dirtyX1) (kosong kalau sama).
+    // Kalau file tidak valid, level lama tetap dipakai.
+    bool reload(int& dirtyX0, int& dirtyX1, int& changedCells, std::string& error);
+
+    int rows() const { return numRows; }
+    int tileSize() const { return size; }
+    int groundHeight() const { return static_cast<int>(LEVEL_GROUND_HEIGHT); }
+    int widthPixels() const { return numCols * size; }
+    void playerStart(float& x, float& y) const;
+
+    bool buildChunk(int index, int chunkCols, LevelChunk& chunk);
+
+    int cols() const { return numCols; }
+    int spawnCount() const { return static_cast<int>(spawns.size()); }
+
+private:
+    std::string path;
+    int size;
+    int numCols;
+    int numRows;
+    int playerCol;
+    int playerRow;
+    std::vector<std::string> lines;     // Isi file terakhir, untuk diff
+    std::vector<Uint8> tiles;           // Column-major (col * rows + row): level melebar cukup di-append
+    std::map<int, char> spawns;         // spawnKey -> 'C' / 'E' / 'e', urut kolom
+
+    std::vector<std::pair<int, int> > changedScratch;
+    std::vector<Uint32> gridScratch;
+
+    // Key cell yang stabil walau level di-edit, dipakai juga sebagai spawnId
+    static int spawnKey(int col, int row) { return (col << 8) | row; }
+
+    void setCell(int col, int row, char c);
+};
+
+#endif
@@ -0,0 +1,213 @@
+#ifndef EMBEDDEDLEVEL_H
+#define EMBEDDEDLEVEL_H
+
+// Level yang di-embed ke binary dan di-parse oleh compiler.
+// Hasilnya tabel konstan (tile, collider, spawn) dengan layout yang
+// sama seperti section .lvl, jadi game memakainya lewat LevelView
+// tanpa parsing dan tanpa alokasi heap. Level yang rusak (karakter
+// tidak dikenal, 'P' dobel/tidak ada) membuat build gagal.
+//
+// Pemakaian:
+//   constexpr std::string_view myLevel[] = { "  P  ", "GGGGG" };
+//   using MyLevel = EmbeddedLevelData<myLevel, 32>;
+//   LevelView view = MyLevel::level.view();
+
+#include "LevelFile.h"
+#include "LevelParse.h"
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+enum EmbeddedLevelError {
+    EMBEDDED_LEVEL_OK,
+    EMBEDDED_LEVEL_EMPTY,
+    EMBEDDED_LEVEL_UNKNOWN_TILE,
+    EMBEDDED_LEVEL_DUPLICATE_PLAYER,
+    EMBEDDED_LEVEL_NO_PLAYER
+};
+
+struct EmbeddedLevelInfo {
+    EmbeddedLevelError error;
+    uint32_t errorRow;          // Lokasi error (0-based), untuk dibaca di diagnostic compiler
+    uint32_t errorCol;
+    uint32_t cols;
+    uint32_t rows;
+    uint32_t coinCount;
+    uint32_t enemyCount;
+};
+
+template <size_t N>
+constexpr EmbeddedLevelInfo measureEmbeddedLevel(const std::string_view (&lines)[N]) {
+    EmbeddedLevelInfo info = {EMBEDDED_LEVEL_OK, 0, 0, 0, static_cast<uint32_t>(N), 0, 0};
+    bool hasPlayer = false;
+
+    for (uint32_t row = 0; row < N; row++) {
+        if (lines[row].length() > info.cols) info.cols = static_cast<uint32_t>(lines[row].length());
+
+        for (uint32_t col = 0; col < lines[row].length(); col++) {
+            switch (classifyLevelChar(lines[row][col])) {
+                case LEVEL_CHAR_COIN: info.coinCount++; break;
+                case LEVEL_CHAR_ENEMY: info.enemyCount++; break;
+                case LEVEL_CHAR_PLAYER:
+                    if (hasPlayer && info.error == EMBEDDED_LEVEL_OK) {
+                        info.error = EMBEDDED_LEVEL_DUPLICATE_PLAYER;
+                        info.errorRow = row;
+                        info.errorCol = col;
+                    }
+                    hasPlayer = true;
+                    break;
+                case LEVEL_CHAR_INVALID:
+                    if (info.error == EMBEDDED_LEVEL_OK) {
+                        info.error = EMBEDDED_LEVEL_UNKNOWN_TILE;
+                        info.errorRow = row;
+                        info.errorCol = col;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    if (info.error == EMBEDDED_LEVEL_OK && info.cols == 0) info.error = EMBEDDED_LEVEL_EMPTY;
+    if (info.error == EMBEDDED_LEVEL_OK && !hasPlayer) info.error = EMBEDDED_LEVEL_NO_PLAYER;
+    return info;
+}
+
+// Tile grid level embedded, baris yang lebih pendek diisi kosong
+template <uint32_t Cols, uint32_t Rows, size_t N>
+constexpr std::array<uint8_t, Cols * Rows> embeddedLevelTiles(const std::string_view (&lines)[N]) {
+    std::array<uint8_t, Cols * Rows> tiles{};
+    for (uint32_t row = 0; row < Rows; row++) {
+        for (uint32_t col = 0; col < lines[row].length() && col < Cols; col++) {
+            tiles[row * Cols + col] = levelTileFor(lines[row][col]);
+        }
+    }
+    return tiles;
+}
+
+template <uint32_t Cols, uint32_t Rows>
+constexpr uint32_t countEmbeddedColliders(const std::array<uint8_t, Cols * Rows>& tiles) {
+    std::array<uint32_t, Cols * Rows> grid{};
+    for (auto& cell : grid) cell = LEVEL_NO_COLLIDER;
+
+    uint32_t count = 0;
+    auto emit = [&count](const LevelCollider&) { return count++; };
+    mergeLevelColliders(tiles, Cols, Rows, 1, grid, emit);
+    return count;
+}
+
+template <uint32_t Cols, uint32_t Rows, uint32_t Colliders, uint32_t Coins, uint32_t Enemies>
+struct EmbeddedLevel {
+    LevelFileHeader header;
+    std::array<uint8_t, Cols * Rows> tiles;
+    std::array<LevelCollider, Colliders> colliders;
+    std::array<uint32_t, Cols * Rows> colliderGrid;
+    std::array<LevelCoinSpawn, Coins> coins;
+    std::array<LevelEnemySpawn, Enemies> enemies;
+
+    // View langsung ke tabel konstan, tanpa validasi ulang
+    LevelView view() const {
+        LevelView v;
+        v.header = &header;
+        v.tiles = tiles.data();
+        v.colliders = colliders.data();
+        v.colliderGrid = colliderGrid.data();
+        v.coins = coins.data();
+        v.enemies = enemies.data();
+        return v;
+    }
+};
+
+template <typename Level, uint32_t Cols, uint32_t Rows, size_t N>
+constexpr Level buildEmbeddedLevel(const std::string_view (&lines)[N], int tileSize) {
+    Level level{};
+
+    for (int i = 0; i < 4; i++) level.header.magic[i] = LEVEL_MAGIC[i];
+    level.header.version = LEVEL_FORMAT_VERSION;
+    level.header.tileSize = static_cast<uint32_t>(tileSize);
+    level.header.cols = Cols;
+    level.header.rows = Rows;
+    level.header.groundHeight = LEVEL_GROUND_HEIGHT;
+    level.header.colliderCount = static_cast<uint32_t>(level.colliders.size());
+    level.header.coinCount = static_cast<uint32_t>(level.coins.size());
+    level.header.enemyCount = static_cast<uint32_t>(level.enemies.size());
+    // fileSize dan offset section tidak dipakai: tidak ada image file
+
+    level.tiles = embeddedLevelTiles<Cols, Rows>(lines);
+
+    uint32_t coinCount = 0;
+    uint32_t enemyCount = 0;
+    for (uint32_t row = 0; row < Rows; row++) {
+        for (uint32_t col = 0; col < lines[row].length() && col < Cols; col++) {
+            int32_t x = static_cast<int32_t>(col) * tileSize;
+            int32_t y = static_cast<int32_t>(row) * tileSize;
+            char c = lines[row][col];
+
+            switch (classifyLevelChar(c)) {
+                case LEVEL_CHAR_COIN:
+                    level.coins[coinCount++] = LevelCoinSpawn{x + tileSize / 2, y + tileSize / 2};
+                    break;
+                case LEVEL_CHAR_ENEMY:
+                    level.enemies[enemyCount++] = LevelEnemySpawn{x, y, levelEnemySpeedFor(c)};
+                    break;
+                case LEVEL_CHAR_PLAYER:
+                    level.header.playerX = x;
+                    level.header.playerY = y;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    // Spawn table diurutkan berdasarkan x (insertion sort, stabil)
+    for (size_t i = 1; i < level.coins.size(); i++) {
+        LevelCoinSpawn value = level.coins[i];
+        size_t j = i;
+        for (; j > 0 && level.coins[j - 1].x > value.x; j--) level.coins[j] = level.coins[j - 1];
+        level.coins[j] = value;
+    }
+    for (size_t i = 1; i < level.enemies.size(); i++) {
+        LevelEnemySpawn value = level.enemies[i];
+        size_t j = i;
+        for (; j > 0 && level.enemies[j - 1].x > value.x; j--) level.enemies[j] = level.enemies[j - 1];
+        level.enemies[j] = value;
+    }
+
+    // Precomputed collision data
+    for (auto& cell : level.colliderGrid) cell = LEVEL_NO_COLLIDER;
+    uint32_t colliderCount = 0;
+    auto emit = [&level, &colliderCount](const LevelCollider& collider) {
+        level.colliders[colliderCount] = collider;
+        return colliderCount++;
+    };
+    mergeLevelColliders(level.tiles, Cols, Rows, tileSize, level.colliderGrid, emit);
+
+    return level;
+}
+
+// Level embedded dari array baris (harus punya static storage duration)
+template <const auto& Lines, int TileSize>
+struct EmbeddedLevelData {
+    static constexpr EmbeddedLevelInfo info = measureEmbeddedLevel(Lines);
+
+    static_assert(info.error != EMBEDDED_LEVEL_EMPTY, "embedded level is empty");
+    static_assert(info.error != EMBEDDED_LEVEL_UNKNOWN_TILE,
+                  "embedded level contains an unknown tile (see info.errorRow/errorCol)");
+    static_assert(info.error != EMBEDDED_LEVEL_DUPLICATE_PLAYER,
+                  "embedded level has a duplicate player start 'P' (see info.errorRow/errorCol)");
+    static_assert(info.error != EMBEDDED_LEVEL_NO_PLAYER, "embedded level has no player start 'P'");
+
+    // Level rusak tetap harus punya tipe yang valid supaya hanya
+    // static_assert di atas yang muncul sebagai error
+    static constexpr uint32_t cols = info.error == EMBEDDED_LEVEL_OK ? info.cols : 1;
+    static constexpr uint32_t rows = info.error == EMBEDDED_LEVEL_OK ? info.rows : 1;
+    static constexpr std::array<uint8_t, cols * rows> tiles = embeddedLevelTiles<cols, rows>(Lines);
+    static constexpr uint32_t colliderCount = countEmbeddedColliders<cols, rows>(tiles);
+
+    using Level = EmbeddedLevel<cols, rows, colliderCount, info.coinCount, info.enemyCount>;
+    static constexpr Level level = buildEmbeddedLevel<Level, cols, rows>(Lines, TileSize);
+};
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef ENTITYSTORE_H
+#define ENTITYSTORE_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+// Handle entity yang stabil walau posisi dense-nya berpindah karena
+// swap-remove. Bit bawah = index registry, bit atas = generation:
+// handle entity yang sudah dihapus tidak valid lagi walau index
+// registry-nya sudah dipakai entity lain.
+typedef int EntityHandle;
+const EntityHandle NO_ENTITY = -1;
+
+// Entity dalam bentuk structure-of-arrays. Field yang dibaca setiap
+// tick (posisi, velocity, fase animasi) ada di array masing-masing dan
+// selalu rapat: entity yang dihapus langsung diganti entity terakhir,
+// jadi loop update tidak pernah melewati entry mati dan hanya menarik
+// kolom yang dipakainya ke cache. Referensi dari luar (proxy
+// broadphase) memakai EntityHandle, bukan index dense.
+//
+// Array dense dibagi dua: entity aktif di [0, awakeCount()), entity
+// yang tidur di [awakeCount(), size()). Loop update cukup menelusuri
+// range aktif; entity yang tidur tidak disentuh sama sekali.
+//
+// Kolom publik supaya loop hot bisa membaca array langsung; index
+// dense berlaku sampai create/destroy/sleep/wake berikutnya.
+class EntityStore {
+public:
+    EntityStore();
+
+    void clear();
+
+    // Alokasikan semua array untuk capacity entity sekaligus. Selama
+    // size() tidak melewati capacity, create/destroy tidak mengalokasi;
+    // pool dengan kapasitas tetap cukup cek full() sebelum create.
+    void reserve(int capacity);
+    int capacity() const { return static_cast<int>(handles.capacity()); }
+    bool full() const { return size() >= capacity(); }
+
+    // Entity baru, aktif. Kolom selain posisi diisi default; pemanggil
+    // mengisi yang perlu lewat indexOf(handle).
+    EntityHandle create(float x, float y);
+    // Swap-remove (pembagian aktif / tidur tetap). Handle entity lain
+    // tetap valid.
+    void destroy(EntityHandle handle);
+
+    bool alive(EntityHandle handle) const;
+    // Index dense, -1 kalau handle sudah tidak valid
+    int indexOf(EntityHandle handle) const;
+    int size() const { return static_cast<int>(handles.size()); }
+
+    int awakeCount() const { return awake; }
+    bool isAwake(int index) const { return index < awake; }
+    // Tukar entity ke batas range aktif / tidur. Entity lain yang ikut
+    // ditukar sudah berada di sisi batas yang sama dengan sebelumnya.
+    void sleep(int index);
+    void wake(int index);
+
+    // Kolom hot
+    std::vector<float> x, y;
+    std::vector<float> prevX, prevY;    // Posisi tick sebelumnya (interpolasi render)
+    std::vector<float> vx, vy;
+    std::vector<float> animPhase;
+
+    // Kolom cold
+    std::vector<int> width, height;     // Hitbox
+    std::vector<int> proxy;             // Id proxy broadphase (-1 = tidak terdaftar)
+    std::vector<int> spawnId;           // Index spawn table level (-1 = bukan dari level)
+    std::vector<int> chunk;             // Chunk tempat entity berada
+    std::vector<int> homeChunk;         // Chunk spawn point-nya
+    std::vector<int> value;
+    std::vector<Uint32> spawnTime;
+    std::vector<float> sleptAt;         // Waktu (detik) mulai tidur, milik pemanggil
+    std::vector<EntityHandle> handles;  // Index dense -> handle
+
+private:
+    static const int INDEX_BITS = 20;
+    static const int INDEX_MASK = (1 << INDEX_BITS) - 1;
+    static const int GENERATION_MASK = 0x7FF;   // Handle tetap positif
+
+    std::vector<int> denseIndex;        // Index registry -> index dense
+    std::vector<Uint16> generations;
+    std::vector<Uint64> liveBits;       // Satu bit per index registry
+    std::vector<int> freeIndices;
+    int awake;
+
+    void swapEntities(int a, int b);
+    template <typename Function> void forEachColumn(Function function);
+};
+
+#endif
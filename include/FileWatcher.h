@@ -0,0 +1,35 @@
+#ifndef FILEWATCHER_H
+#define FILEWATCHER_H
+
+#include <string>
+
+// Mendeteksi perubahan satu file tanpa blocking. Di Linux memakai
+// inotify pada direktori file (editor sering menyimpan lewat rename);
+// platform lain memakai cek mtime berkala.
+class FileWatcher {
+public:
+    FileWatcher();
+    ~FileWatcher();
+
+    bool watch(const std::string& path, std::string& error);
+    void stop();
+
+    // True kalau file berubah sejak poll terakhir
+    bool poll();
+
+private:
+    std::string path;
+    std::string fileName;
+#ifdef __linux__
+    int fd;
+    int wd;
+#else
+    long long lastModified;
+    unsigned int lastCheck;
+#endif
+
+    FileWatcher(const FileWatcher&);
+    FileWatcher& operator=(const FileWatcher&);
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef FLAGSET_H
+#define FLAGSET_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+// Bitset rata dengan index int >= 0 (spawnId, cell). Pengganti set
+// berbasis node untuk state permanen: set/reset tidak mengalokasi
+// selama index masih di bawah limit(), jadi pemanggil cukup
+// reserve() waktu data baru masuk (chunk di-stream), bukan waktu event.
+// Index negatif dan index di bawah lowest() tidak pernah tercatat.
+class FlagSet {
+public:
+    FlagSet() : base(0) {}
+
+    // Semua bit jadi 0 dan window kembali mulai dari 0, kapasitas dipertahankan
+    void clear();
+    // Pastikan index [lowest(), bits) muat; tumbuh minimal dua kali lipat
+    void reserve(int bits);
+    // Lupakan bit di bawah index (dibulatkan ke bawah per 64). Buffer
+    // tidak dilepas, jadi window yang terus bergeser maju tidak
+    // menambah memory.
+    void discardBelow(int index);
+
+    int lowest() const { return base; }
+    int limit() const { return base + static_cast<int>(words.size()) * 64; }
+
+    bool test(int index) const {
+        if (index < base || index >= limit()) return false;
+        index -= base;
+        return (words[index >> 6] >> (index & 63)) & 1;
+    }
+    void set(int index) {
+        if (index < base || index < 0) return;
+        if (index >= limit()) reserve(index + 1);
+        index -= base;
+        words[index >> 6] |= Uint64(1) << (index & 63);
+    }
+    void reset(int index) {
+        if (index < base || index >= limit()) return;
+        index -= base;
+        words[index >> 6] &= ~(Uint64(1) << (index & 63));
+    }
+
+private:
+    int base;                   // Index bit pertama di words[0], kelipatan 64
+    std::vector<Uint64> words;
+};
+
+#endif
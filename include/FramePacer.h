@@ -0,0 +1,81 @@
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+struct FrameTimeStats {
+    int frames;         // Jumlah sampel (maks FRAME_HISTORY terakhir)
+    double meanMs;
+    double stddevMs;
+    double p99Ms;
+    double maxMs;
+};
+
+// Penjadwal frame berbasis SDL_GetPerformanceCounter. Deadline frame
+// dihitung absolut (tidak drift seperti SDL_Delay(16) per frame):
+// sleep kasar sampai sedikit sebelum deadline, lalu spin untuk sisa
+// kurang dari satu milidetik. Margin sleep mengikuti seberapa telat
+// SDL_Delay bangun di mesin ini.
+//
+// Kalau vsync benar-benar aktif (diukur dari interval present, bukan
+// hanya flag renderer), pacer tidak menahan frame lagi kecuali batas
+// fps lebih rendah dari refresh rate. Kalau interval present kemudian
+// keluar dari grid refresh, vsync diukur ulang.
+class FramePacer {
+public:
+    FramePacer();
+
+    // fps <= 0: tanpa batas
+    void setTargetFps(int fps);
+    int targetFps() const { return capFps; }
+
+    // vsyncRequested: renderer dibuat dengan PRESENTVSYNC.
+    // refreshRate: refresh display (Hz), 0 kalau tidak diketahui.
+    void setVsync(bool vsyncRequested, int refreshRate);
+    bool vsyncActive() const { return vsync == VSYNC_ACTIVE; }
+    bool vsyncMeasured() const { return vsync != VSYNC_CALIBRATING; }
+
+    // Panggil sekali per frame setelah present
+    void wait();
+    // Frame ini ditahan di luar pacer (idle / window tersembunyi):
+    // intervalnya tidak masuk statistik dan jadwal dimulai ulang
+    void idle();
+
+    // Statistik frame time (interval antar wait()) dari history terakhir
+    FrameTimeStats stats() const;
+
+private:
+    enum VsyncState {
+        VSYNC_OFF,
+        VSYNC_CALIBRATING,      // Flag vsync ada, interval present sedang diukur
+        VSYNC_ACTIVE
+    };
+
+    Uint64 frequency;
+    Uint64 period;              // Counter per frame, 0 = tanpa batas
+    Uint64 deadline;
+    Uint64 lastFrame;
+    int capFps;
+    int displayHz;              // Refresh yang dipakai (hasil ukur kalau vsync aktif)
+    int reportedHz;             // Refresh dari display, 0 = tidak diketahui
+    double refreshMs;           // Periode refresh hasil kalibrasi, 0 = vsync tidak aktif
+    int driftFrames;            // Interval di luar grid refresh selama vsync aktif
+    VsyncState vsync;
+    std::vector<double> calibration;    // Interval present saat kalibrasi (ms)
+    double sleepOvershootMs;            // Rata-rata telat bangun SDL_Delay
+
+    std::vector<float> history;         // Ring buffer frame time (ms)
+    size_t historyNext;
+    size_t historyCount;
+
+    bool pacing() const;
+    void sleepUntil(Uint64 target);
+    void record(double frameMs);
+    void startCalibration();
+    void finishCalibration();
+    bool onRefreshGrid(double periodMs) const;
+    void checkDrift(double frameMs);
+};
+
+#endif
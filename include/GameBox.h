@@ -1,6 +1,7 @@
 #ifndef GAMEBOX_H
 #define GAMEBOX_H
 
+#include "RenderCanvas.h"
 #include <SDL2/SDL.h>
 #include <vector>
 #include <string>
@@ -12,6 +13,8 @@ struct Platform {
     bool isHit;
 };
 
+// Enemy dan Coin: data spawn yang dihasilkan ChunkSource. Entity yang
+// sedang hidup disimpan World di EntityStore (lihat EntityStore.h).
 struct Enemy {
     float x, y;
     float vx;
@@ -19,32 +22,39 @@ struct Enemy {
     bool active;
     float leftBound;    // Tambahan: batas kiri enemy patrol
     float rightBound;   // Tambahan: batas kanan enemy patrol
+    int spawnId;        // Tambahan: index di spawn table level (-1 = bukan dari level)
 };
 
 struct Coin {
     int x, y;
     bool collected;
     float animPhase;
-};
-
-struct FloatingText {
-    float x, y;
-    float vy;
-    int value;
-    Uint32 spawnTime;
-    bool active;
+    int spawnId;        // Tambahan: index di spawn table level (-1 = muncul dari '?')
 };
 
 // Struct baru untuk level chunk system
+// World hanya menyimpan chunk di sekitar kamera (lihat World.h)
 struct LevelChunk {
     std::vector<Platform> platforms;
-    std::vector<Coin> coins;
+    std::vector<Coin> coins;            // Spawn; dipindah World ke EntityStore
     std::vector<Enemy> enemies;
     int startX;         // Posisi X awal chunk
     int width;          // Lebar chunk dalam pixels
+    int index;          // Tambahan: nomor chunk (startX / lebar chunk penuh)
+    int cols;           // Tambahan: ukuran grid tile chunk
+    int rows;
+    std::vector<Uint8> tiles;           // Tambahan: tile ID, cols * rows
+    std::vector<Uint16> colliderGrid;   // Tambahan: index ke platforms per cell
+    Uint32 revision;    // Tambahan: berubah setiap tampilan tile chunk berubah (cache texture)
 };
 
-bool runGameBox(SDL_Renderer* renderer);
+const Uint16 CHUNK_NO_COLLIDER = 0xFFFF;
+
 extern int currentStage;
+extern bool endlessMode;        // Level di-generate dari endlessSeed, tanpa ujung
+extern Uint32 endlessSeed;
+extern std::string watchLevelPath;  // Level teks yang di-hot reload (kosong = tidak ada)
+extern CanvasScale canvasScale;     // Skala canvas logical ke window (--scale)
+extern int activationMargin;        // Margin region aktif entity di luar layar (--active-margin)
 
 #endif
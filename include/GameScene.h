@@ -0,0 +1,187 @@
+#ifndef GAMESCENE_H
+#define GAMESCENE_H
+
+#include "GameBox.h"
+#include "World.h"
+#include "ChunkSource.h"
+#include "EditableLevel.h"
+#include "FileWatcher.h"
+#include "StageManager.h"
+#include "ChunkTextureCache.h"
+#include "HudLayer.h"
+#include "RenderQueue.h"
+#include "GlyphAtlas.h"
+#include "SpriteSheet.h"
+#include "EntityStore.h"
+#include "GameSnapshot.h"
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Gameplay sebagai scene milik Game, sama seperti Menu. Font, level,
+// dan texture disiapkan sekali di init; restart (R) dan kembali dari
+// menu tidak memuat apa pun dari disk. Loop dan pacing frame hanya di
+// Game (main.cpp). Implementasi di GameBox.cpp bersama tabel level.
+//
+// Simulasi (input, physics, collision, streaming World) berjalan di
+// thread sendiri dengan tick tetap dan mem-publish GameSnapshot lewat
+// SnapshotBuffer. Thread SDL hanya membaca snapshot terbaru dan
+// menggambarnya, jadi present yang lambat tidak menunda logika game.
+// Semua member di bagian "thread simulasi" hanya disentuh thread itu
+// setelah init.
+class GameScene {
+public:
+    GameScene();
+    ~GameScene();
+
+    // Buka font dan siapkan level sesuai mode (endless / --watch / stage)
+    bool init(SDL_Renderer* renderer, int viewWidth, int viewHeight);
+    bool ready() const { return loaded; }
+    void cleanup();
+
+    void handleEvent(const SDL_Event& e);
+    // Kirim input keyboard terbaru ke simulasi
+    void update();
+    void render(RenderQueue& queue);
+
+    // Simulasi berhenti selama pause (menu, window tidak fokus)
+    void setPaused(bool paused);
+
+    // Ukuran canvas berubah (mode native setelah toggle fullscreen)
+    void resize(int viewWidth, int viewHeight);
+    // Isi render target hilang (SDL_RENDER_TARGETS_RESET / DEVICE_RESET)
+    void invalidateCache();
+
+private:
+    // ===== Thread SDL =====
+    SDL_Renderer* renderer;
+    int windowWidth;
+    int windowHeight;
+    bool loaded;
+
+    // Font UI
+    TTF_Font* gameFont;
+    TTF_Font* smallFont;
+    GlyphAtlas gameText;
+    GlyphAtlas smallText;
+
+    // Render
+    std::unique_ptr<ChunkTextureCache> tileLayer;
+    std::unique_ptr<HudLayer> hud;
+    SpriteSheet sprites;
+    bool showRenderStats;
+
+    // ===== Dibagi dua thread =====
+    enum CommandType {
+        COMMAND_JUMP,
+        COMMAND_RESTART,
+        COMMAND_RESIZE
+    };
+    struct Command {
+        CommandType type;
+        int width;
+        int height;
+    };
+
+    SnapshotBuffer snapshots;
+    std::thread simThread;
+    std::mutex simMutex;
+    std::condition_variable simWake;
+    std::vector<Command> commands;      // Dijaga simMutex
+    bool simPaused;                     // Dijaga simMutex
+    bool simStop;                       // Dijaga simMutex
+    std::atomic<int> moveInput;         // Bit INPUT_LEFT / INPUT_RIGHT
+
+    // ===== Thread simulasi =====
+    int simWidth;
+    int simHeight;
+    std::vector<Command> pendingCommands;
+
+    // Player state
+    float playerX;
+    float playerY;
+    float playerStartX;
+    float playerStartY;
+    float velocityX;
+    float velocityY;
+    bool isOnGround;
+    bool facingRight;
+
+    // Camera position (world coordinate)
+    float cameraX;
+
+    // State tick sebelumnya, untuk interpolasi render
+    float prevPlayerX;
+    float prevPlayerY;
+    float prevCameraX;
+
+    // Game state
+    int score;
+    int lives;
+    bool gameOver;
+    bool levelComplete;
+    Uint32 deathTime;
+    float animPhase;
+    // Pool floating text (x, y, prevY, vy, value, spawnTime) dengan
+    // kapasitas tetap. textOrder: handle urut spawn, kepalanya yang tertua.
+    EntityStore floatingTexts;
+    std::vector<EntityHandle> textOrder;
+    int textOrderHead;
+    int textOrderCount;
+
+    // Simulasi fixed timestep
+    Uint64 simTicks;
+
+    // Level. Mode stage: World milik StageManager dan ditukar saat pindah stage
+    World* world;
+    World ownWorld;
+    std::unique_ptr<ChunkSource> levelSource;
+    StreamingConfig streaming;
+    StageManager stages;
+    bool stageMode;
+    int levelWidthPixels;       // -1 = level tanpa ujung
+
+    // Hot reload: level teks di-watch dan di-patch saat file berubah
+    EditableLevelSource* editableLevel;
+    FileWatcher levelWatcher;
+
+    // Broadphase milik World yang aktif
+    Broadphase* broadphase;
+    int playerProxy;
+    std::vector<int> candidates;
+    std::vector<ColliderRef> nearbyColliders;
+    std::vector<std::pair<int, int> > enemyPairs;
+
+    void simulationLoop();
+    void startSimulation();
+    void stopSimulation();
+    void pushCommand(CommandType type, int width = 0, int height = 0);
+    void applyCommands();
+    // Salin state yang terlihat ke slot belakang lalu publish
+    void publishSnapshot();
+
+    // Satu tick simulasi; currentTime = waktu game dalam ms
+    void step(Uint32 currentTime);
+    // Mulai ulang stage sekarang dari World yang sudah dimuat
+    void restart();
+    // Player ke titik start World aktif, proxy broadphase dibuat ulang
+    void placePlayer();
+    bool enterNextStage();
+    void spawnFloatingText(float x, float y, float vy, int value, Uint32 time);
+    void clearFloatingTexts();
+    void snapInterpolation();
+    void printStageInfo();
+    void closeFonts();
+
+    GameScene(const GameScene&);
+    GameScene& operator=(const GameScene&);
+};
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef GAMESNAPSHOT_H
+#define GAMESNAPSHOT_H
+
+#include "World.h"
+#include "HudLayer.h"
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <vector>
+
+struct SnapshotCoin {
+    int x, y;
+    int frame;          // Frame SPRITE_COIN
+};
+
+struct SnapshotEnemy {
+    float prevX, x;
+    int y;
+};
+
+struct SnapshotText {
+    float x;
+    float prevY, y;
+    int value;
+    Uint32 spawnTime;
+};
+
+// Hasil satu tick simulasi: semua yang dibutuhkan render, disalin dari
+// World dan state player supaya thread render tidak pernah menyentuh
+// state simulasi. Posisi tick sebelumnya ikut disimpan untuk interpolasi.
+struct GameSnapshot {
+    Uint64 tick;
+    Uint32 simTime;             // Waktu game (ms) pada tick ini
+    Uint64 publishCounter;      // SDL_GetPerformanceCounter saat dipublish
+
+    float prevCameraX, cameraX;
+    float prevPlayerX, prevPlayerY;
+    float playerX, playerY;
+    bool playerVisible;
+    bool playerOnGround;
+    int playerFrame;            // Frame SPRITE_PLAYER_RUN
+
+    int score;
+    int lives;
+    HudMode mode;
+
+    ActivationStats activation; // Enemy/coin aktif dan tidur (F3)
+    SDL_Rect ground;            // Ground plane di sekitar kamera (koordinat world)
+    TileView tiles;
+    std::vector<SnapshotCoin> coins;
+    std::vector<SnapshotEnemy> enemies;
+    std::vector<SnapshotText> texts;
+
+    GameSnapshot()
+        : tick(0), simTime(0), publishCounter(0), prevCameraX(0.0f), cameraX(0.0f),
+          prevPlayerX(0.0f), prevPlayerY(0.0f), playerX(0.0f), playerY(0.0f),
+          playerVisible(false), playerOnGround(false), playerFrame(0),
+          score(0), lives(0), mode(HUD_PLAYING), activation{0, 0, 0, 0, 0, 0}, ground{0, 0, 0, 0} {}
+};
+
+// Triple buffer lock-free antara thread simulasi (satu penulis) dan
+// thread render (satu pembaca). Penulis mengisi slot belakang lalu
+// menukarnya dengan slot tengah; pembaca mengambil slot tengah hanya
+// kalau ada yang baru. Tidak ada pihak yang menunggu: render selalu
+// membaca snapshot lengkap terakhir, simulasi tidak tertahan render.
+class SnapshotBuffer {
+public:
+    SnapshotBuffer() : back(0), front(1), middle(2) {}
+
+    // Hanya thread simulasi
+    GameSnapshot& writeSlot() { return slots[back]; }
+    void publish() {
+        back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & SLOT_MASK;
+    }
+
+    // Hanya thread render. Snapshot terbaru, atau yang terakhir dibaca
+    // kalau simulasi belum publish lagi.
+    const GameSnapshot& read() {
+        if (middle.load(std::memory_order_relaxed) & FRESH) {
+            front = middle.exchange(front, std::memory_order_acq_rel) & SLOT_MASK;
+        }
+        return slots[front];
+    }
+
+private:
+    static const int SLOT_MASK = 3;
+    static const int FRESH = 4;
+
+    GameSnapshot slots[3];
+    int back;
+    int front;
+    std::atomic<int> middle;
+
+    SnapshotBuffer(const SnapshotBuffer&);
+    SnapshotBuffer& operator=(const SnapshotBuffer&);
+};
+
+#endif
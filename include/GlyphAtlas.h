@@ -0,0 +1,74 @@
+#ifndef GLYPHATLAS_H
+#define GLYPHATLAS_H
+
+#include "RenderQueue.h"
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Atlas glyph ASCII (32..126) untuk satu font dengan satu ukuran.
+// Glyph di-rasterize sekali ke satu texture saat pertama dipakai; teks
+// digambar sebagai quad dari texture itu, jadi semua teks dengan font
+// yang sama masuk satu batch geometry di RenderQueue. Warna teks lewat
+// modulasi per quad (glyph di atlas berwarna putih).
+class GlyphAtlas {
+public:
+    GlyphAtlas();
+    ~GlyphAtlas();
+
+    // Font tetap milik pemanggil dan harus hidup selama atlas dipakai
+    void init(TTF_Font* font);
+    // Lepas texture (sebelum renderer dihancurkan); dibangun ulang saat dipakai lagi
+    void release();
+
+    bool valid() const { return font != nullptr; }
+    int lineHeight() const { return height; }
+    int textWidth(const char* text);
+
+    // (x, y) = pojok kiri atas; centered: x adalah tengah teks
+    void draw(RenderQueue& queue, int layer, const char* text, int x, int y,
+              SDL_Color color, bool centered = false);
+
+private:
+    static const int FIRST_CHAR = 32;
+    static const int LAST_CHAR = 126;
+    static const int GLYPH_COUNT = LAST_CHAR - FIRST_CHAR + 1;
+    static const int ATLAS_MAX_WIDTH = 1024;
+    static const int GLYPH_PADDING = 1;
+    // String yang sering berubah (skor) tidak boleh membuat cache tumbuh terus
+    static const size_t MAX_CACHED_TEXTS = 128;
+
+    struct Glyph {
+        SDL_Rect src;       // w = 0: tidak ada bitmap (spasi / gagal render)
+        int advance;
+    };
+
+    struct GlyphQuad {
+        SDL_Rect src;
+        int offsetX;
+    };
+
+    // Hasil layout satu string, di-cache per isi string
+    struct TextLayout {
+        int width;
+        std::vector<GlyphQuad> quads;
+    };
+
+    TTF_Font* font;
+    SDL_Texture* texture;
+    bool built;
+    int height;
+    Glyph glyphs[GLYPH_COUNT];
+    std::unordered_map<std::string, TextLayout> layouts;
+    std::string lookupKey;
+
+    bool build(SDL_Renderer* renderer);
+    const TextLayout& layoutFor(const char* text);
+
+    GlyphAtlas(const GlyphAtlas&);
+    GlyphAtlas& operator=(const GlyphAtlas&);
+};
+
+#endif
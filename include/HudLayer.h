@@ -0,0 +1,81 @@
+#ifndef HUDLAYER_H
+#define HUDLAYER_H
+
+#include "RenderQueue.h"
+#include "GlyphAtlas.h"
+#include <SDL2/SDL.h>
+
+enum HudMode {
+    HUD_PLAYING,
+    HUD_LEVEL_COMPLETE,
+    HUD_GAME_OVER
+};
+
+struct HudRenderStats {
+    int textureCopies;      // Copy texture HUD/panel frame ini
+    int redraws;            // Bagian yang digambar ulang ke texture frame ini
+};
+
+// HUD (kotak skor dan nyawa) dan panel game over / level complete
+// sebagai layer retained. Isi digambar ke texture hanya kalau skor,
+// nyawa atau mode berubah; frame biasa cukup satu copy texture.
+// Tanpa render target, isi di-submit langsung ke queue setiap frame.
+class HudLayer {
+public:
+    explicit HudLayer(SDL_Renderer* renderer);
+    ~HudLayer();
+
+    // Atlas milik pemanggil; boleh nullptr (teks tidak digambar)
+    void init(GlyphAtlas* largeText, GlyphAtlas* smallText);
+
+    // Tandai dirty hanya kalau nilainya berubah
+    void setScore(int score);
+    void setLives(int lives);
+    void setMode(HudMode mode);
+
+    // Memakai layer s.d. layer + 4: HUD, detail HUD, overlay, panel, detail panel
+    void draw(RenderQueue& queue, int layer, int viewWidth, int viewHeight);
+
+    // Isi texture hilang (SDL_RENDER_TARGETS_RESET) - gambar ulang semua
+    void invalidate();
+
+    const HudRenderStats& stats() const { return frameStats; }
+
+private:
+    enum Part {
+        PART_STATUS,        // Kotak skor + nyawa di pojok kiri atas
+        PART_PANEL,         // Dialog tengah layar
+        PART_COUNT
+    };
+
+    struct Cache {
+        SDL_Texture* texture;
+        int width;
+        int height;
+        bool dirty;
+    };
+
+    SDL_Renderer* renderer;
+    GlyphAtlas* largeText;
+    GlyphAtlas* smallText;
+    bool targetsSupported;
+    Cache parts[PART_COUNT];
+    RenderQueue composeQueue;   // Batch saat menggambar ke texture
+    HudRenderStats frameStats;
+
+    int score;
+    int lives;
+    HudMode mode;
+
+    void compose(Part part, RenderQueue& queue, int layer, int x, int y);
+    void composeStatus(RenderQueue& queue, int layer, int x, int y);
+    void composePanel(RenderQueue& queue, int layer, int x, int y);
+    // true = texture part siap dipakai
+    bool refresh(Part part);
+    void drawPart(Part part, RenderQueue& queue, int layer, int x, int y);
+
+    HudLayer(const HudLayer&);
+    HudLayer& operator=(const HudLayer&);
+};
+
+#endif
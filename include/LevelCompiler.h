@@ -0,0 +1,44 @@
+#ifndef LEVELCOMPILER_H
+#define LEVELCOMPILER_H
+
+#include "LevelFormat.h"
+#include "LevelParse.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Legend ASCII level (aturannya di LevelParse.h):
+// ' ' = empty space
+// 'G' = ground/grass block
+// 'B' = brick block
+// '?' = question block (coin block)
+// 'C' = coin
+// 'E' = enemy (moving right)
+// 'e' = enemy (moving left)
+// 'P' = player start position
+
+// Hasil parse level ASCII sebelum di-layout ke image .lvl
+struct ParsedLevel {
+    uint32_t cols;
+    uint32_t rows;
+    std::vector<uint8_t> tiles;
+    std::vector<LevelCollider> colliders;   // hasil greedy merge
+    std::vector<uint32_t> colliderGrid;
+    std::vector<LevelCoinSpawn> coins;      // urut x
+    std::vector<LevelEnemySpawn> enemies;   // urut x
+    bool hasPlayer;
+    int32_t playerX;
+    int32_t playerY;
+};
+
+// Parse level ASCII (atau potongan level, 'P' tidak wajib).
+// Dipakai juga oleh generator endless untuk tiap section.
+bool parseLevel(const std::vector<std::string>& rows, int tileSize,
+                ParsedLevel& level, std::string& error);
+
+// Compile level ASCII menjadi image .lvl (lihat LevelFormat.h).
+// Dipakai oleh tools/levelc dan sebagai fallback di game.
+bool compileLevel(const std::vector<std::string>& rows, int tileSize,
+                  std::vector<uint8_t>& image, std::string& error);
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef LEVELFILE_H
+#define LEVELFILE_H
+
+#include "LevelFormat.h"
+#include <cstddef>
+#include <string>
+
+// File read-only yang di-map ke memory. Halaman file dibagi oleh
+// semua proses yang membuka level yang sama.
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    bool open(const std::string& path, std::string& error);
+    void close();
+
+    const void* data() const { return mapped; }
+    size_t size() const { return length; }
+
+    // Sentuh setiap halaman supaya sudah ada di memory sebelum dipakai
+    void prefault() const;
+
+private:
+    const void* mapped;
+    size_t length;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+};
+
+// View ke image .lvl yang sudah divalidasi. Semua pointer menunjuk
+// langsung ke image (mmap atau buffer), tidak ada data yang di-copy.
+struct LevelView {
+    const LevelFileHeader* header;
+    const uint8_t* tiles;
+    const LevelCollider* colliders;
+    const uint32_t* colliderGrid;
+    const LevelCoinSpawn* coins;
+    const LevelEnemySpawn* enemies;
+
+    LevelView();
+
+    bool bind(const void* data, size_t size, std::string& error);
+    bool valid() const { return header != nullptr; }
+
+    int cols() const { return static_cast<int>(header->cols); }
+    int rows() const { return static_cast<int>(header->rows); }
+    int tileSize() const { return static_cast<int>(header->tileSize); }
+    int groundHeight() const { return static_cast<int>(header->groundHeight); }
+    int colliderCount() const { return static_cast<int>(header->colliderCount); }
+    int coinCount() const { return static_cast<int>(header->coinCount); }
+    int enemyCount() const { return static_cast<int>(header->enemyCount); }
+};
+
+// Level .lvl yang dibuka lewat mmap
+class LevelFile {
+public:
+    bool open(const std::string& path, std::string& error);
+    void close();
+
+    const LevelView& view() const { return levelView; }
+    void prefault() const { file.prefault(); }
+
+private:
+    MappedFile file;
+    LevelView levelView;
+};
+
+#endif
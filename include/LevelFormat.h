@@ -0,0 +1,80 @@
+#ifndef LEVELFORMAT_H
+#define LEVELFORMAT_H
+
+// Format binary level (.lvl) yang dihasilkan oleh tools/levelc.
+// Header ini sengaja tidak bergantung pada SDL supaya bisa dipakai
+// oleh level compiler maupun game.
+//
+// Layout file (little-endian, semua section rata 4 byte):
+//   LevelFileHeader
+//   tiles        : cols * rows x uint8_t (TileId), row-major
+//   colliders    : colliderCount x LevelCollider
+//   colliderGrid : cols * rows x uint32_t (index collider, atau LEVEL_NO_COLLIDER)
+//   coins        : coinCount  x LevelCoinSpawn,  urut berdasarkan x
+//   enemies      : enemyCount x LevelEnemySpawn, urut berdasarkan x
+//
+// Collider sudah di-merge oleh compiler: tile solid yang bersebelahan
+// digabung jadi persegi panjang sebesar mungkin, '?' tetap satu per tile.
+// Ground strip di bawah level tidak disimpan per tile, hanya tingginya
+// (groundHeight) - game memperlakukannya sebagai satu plane.
+//
+// Game me-mmap file ini dan memakai section-nya langsung tanpa parsing.
+
+#include <cstdint>
+
+const char LEVEL_MAGIC[4] = {'G', 'L', 'V', 'L'};
+const uint32_t LEVEL_FORMAT_VERSION = 2;
+const uint32_t LEVEL_NO_COLLIDER = 0xFFFFFFFFu;
+
+// Tile ID yang disimpan di grid (1 byte per cell)
+enum TileId : uint8_t {
+    TILE_EMPTY = 0,
+    TILE_GROUND,      // 'G'
+    TILE_BRICK,       // 'B'
+    TILE_QUESTION     // '?'
+};
+
+// Collision flags per collider, dihitung oleh compiler dari tile ID
+const uint8_t LEVEL_COLLIDE_SOLID = 0x01;   // Menahan player
+const uint8_t LEVEL_COLLIDE_BUMP  = 0x02;   // Bisa dipukul dari bawah
+
+struct LevelFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t fileSize;
+    uint32_t tileSize;
+    uint32_t cols;
+    uint32_t rows;
+    int32_t playerX;
+    int32_t playerY;
+    uint32_t groundHeight;
+    uint32_t tilesOffset;
+    uint32_t colliderCount;
+    uint32_t collidersOffset;
+    uint32_t colliderGridOffset;
+    uint32_t coinCount;
+    uint32_t coinsOffset;
+    uint32_t enemyCount;
+    uint32_t enemiesOffset;
+};
+
+struct LevelCollider {
+    int32_t x, y, w, h;     // Rect world (pixel)
+    uint32_t flags;         // LEVEL_COLLIDE_*
+};
+
+struct LevelCoinSpawn {
+    int32_t x, y;       // Titik tengah coin (pixel)
+};
+
+struct LevelEnemySpawn {
+    int32_t x, y;       // Pojok kiri atas (pixel)
+    int32_t vx;         // Kecepatan awal (pixel/detik)
+};
+
+static_assert(sizeof(LevelFileHeader) == 68, "LevelFileHeader layout changed");
+static_assert(sizeof(LevelCollider) == 20, "LevelCollider layout changed");
+static_assert(sizeof(LevelCoinSpawn) == 8, "LevelCoinSpawn layout changed");
+static_assert(sizeof(LevelEnemySpawn) == 12, "LevelEnemySpawn layout changed");
+
+#endif
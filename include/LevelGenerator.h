@@ -0,0 +1,65 @@
+#ifndef LEVELGENERATOR_H
+#define LEVELGENERATOR_H
+
+#include "ChunkSource.h"
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Generate satu section level endless dalam legend yang sama dengan
+// mainLevel ('G', 'B', '?', 'C', 'E', 'e'). Hasilnya hanya bergantung
+// pada (seed, index), jadi urutan generate tidak mempengaruhi level.
+void generateSection(uint32_t seed, int index, int cols, int rows,
+                     std::vector<std::string>& out);
+
+// Level endless: section di-generate di worker thread beberapa chunk
+// di depan kamera. Main thread hanya mengambil section yang sudah
+// jadi (swap vector), tidak pernah menunggu generator.
+class GeneratedChunkSource : public ChunkSource {
+public:
+    GeneratedChunkSource(uint32_t seed, int rows, int tileSize, int aheadChunks = 8);
+    ~GeneratedChunkSource();
+
+    int rows() const { return numRows; }
+    int tileSize() const { return size; }
+    int groundHeight() const;
+    int widthPixels() const { return -1; }
+    void playerStart(float& x, float& y) const;
+
+    bool buildChunk(int index, int chunkCols, LevelChunk& chunk);
+    int spawnIdFloor(int index) const;
+
+    // Blok sampai chunk siap - hanya untuk loading awal
+    void waitForChunk(int index, int chunkCols);
+
+    uint32_t seed() const { return levelSeed; }
+
+private:
+    uint32_t levelSeed;
+    int numRows;
+    int size;
+    int ahead;
+
+    std::thread worker;
+    std::mutex lock;
+    std::condition_variable wake;       // ada request baru untuk worker
+    std::condition_variable finished;   // ada section baru yang selesai
+    bool stopping;
+    int chunkCols;                      // 0 = belum ada request
+    int anchor;                         // chunk terakhir yang diminta World
+    std::vector<int> requests;          // chunk yang dibutuhkan sekarang (prioritas)
+    std::map<int, LevelChunk> ready;
+    int inProgress;
+
+    void workerLoop();
+    bool nextJob(int& index);
+    void request(int index, int cols);
+    void buildSection(int index, int cols, LevelChunk& chunk,
+                      std::vector<std::string>& rowsScratch);
+};
+
+#endif
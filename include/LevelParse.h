@@ -0,0 +1,125 @@
+#ifndef LEVELPARSE_H
+#define LEVELPARSE_H
+
+// Aturan legend level yang dipakai bersama oleh levelc (runtime,
+// std::vector) dan level embedded (compile time, std::array).
+// Semua fungsi di sini constexpr supaya bisa dievaluasi compiler.
+
+#include "LevelFormat.h"
+#include <cstdint>
+
+// Kecepatan patrol enemy (pixel/detik)
+constexpr int32_t LEVEL_ENEMY_SPEED = 50;
+
+// Tinggi ground strip di bawah level (pixel)
+constexpr uint32_t LEVEL_GROUND_HEIGHT = 80;
+
+// Arti satu karakter legend
+enum LevelChar {
+    LEVEL_CHAR_EMPTY,       // ' '
+    LEVEL_CHAR_TILE,        // 'G', 'B', '?'
+    LEVEL_CHAR_COIN,        // 'C'
+    LEVEL_CHAR_ENEMY,       // 'E' / 'e'
+    LEVEL_CHAR_PLAYER,      // 'P'
+    LEVEL_CHAR_INVALID
+};
+
+constexpr LevelChar classifyLevelChar(char c) {
+    switch (c) {
+        case ' ': return LEVEL_CHAR_EMPTY;
+        case 'G':
+        case 'B':
+        case '?': return LEVEL_CHAR_TILE;
+        case 'C': return LEVEL_CHAR_COIN;
+        case 'E':
+        case 'e': return LEVEL_CHAR_ENEMY;
+        case 'P': return LEVEL_CHAR_PLAYER;
+        default:  return LEVEL_CHAR_INVALID;
+    }
+}
+
+constexpr uint8_t levelTileFor(char c) {
+    switch (c) {
+        case 'G': return TILE_GROUND;
+        case 'B': return TILE_BRICK;
+        case '?': return TILE_QUESTION;
+        default:  return TILE_EMPTY;
+    }
+}
+
+constexpr int32_t levelEnemySpeedFor(char c) {
+    return c == 'E' ? LEVEL_ENEMY_SPEED : -LEVEL_ENEMY_SPEED;
+}
+
+constexpr uint8_t levelCollisionFor(uint8_t tile) {
+    switch (tile) {
+        case TILE_GROUND:
+        case TILE_BRICK:
+            return LEVEL_COLLIDE_SOLID;
+        case TILE_QUESTION:
+            return LEVEL_COLLIDE_SOLID | LEVEL_COLLIDE_BUMP;
+        default:
+            return 0;
+    }
+}
+
+// Greedy merge: tile solid biasa digabung jadi persegi panjang sebesar
+// mungkin (melebar dulu, lalu ke bawah). '?' tetap satu collider per tile
+// karena masing-masing punya state hit sendiri.
+//
+// grid harus sudah berisi LEVEL_NO_COLLIDER; emit(collider) menyimpan
+// collider baru dan mengembalikan index-nya.
+template <typename Tiles, typename Grid, typename Emit>
+constexpr void mergeLevelColliders(const Tiles& tiles, uint32_t numCols, uint32_t numRows,
+                                   int tileSize, Grid& grid, Emit& emit) {
+    for (uint32_t row = 0; row < numRows; row++) {
+        for (uint32_t col = 0; col < numCols; col++) {
+            uint32_t cell = row * numCols + col;
+            uint8_t flags = levelCollisionFor(tiles[cell]);
+            if (!flags || grid[cell] != LEVEL_NO_COLLIDER) continue;
+
+            uint32_t width = 1;
+            uint32_t height = 1;
+
+            if (!(flags & LEVEL_COLLIDE_BUMP)) {
+                // Lebarkan ke kanan
+                while (col + width < numCols) {
+                    uint32_t next = cell + width;
+                    if (levelCollisionFor(tiles[next]) != flags || grid[next] != LEVEL_NO_COLLIDER) break;
+                    width++;
+                }
+
+                // Turunkan selama seluruh baris di bawahnya juga cocok
+                while (row + height < numRows) {
+                    uint32_t start = (row + height) * numCols + col;
+                    bool fullRow = true;
+                    for (uint32_t i = 0; i < width; i++) {
+                        if (levelCollisionFor(tiles[start + i]) != flags || grid[start + i] != LEVEL_NO_COLLIDER) {
+                            fullRow = false;
+                            break;
+                        }
+                    }
+                    if (!fullRow) break;
+                    height++;
+                }
+            }
+
+            LevelCollider collider = {
+                static_cast<int32_t>(col) * tileSize,
+                static_cast<int32_t>(row) * tileSize,
+                static_cast<int32_t>(width) * tileSize,
+                static_cast<int32_t>(height) * tileSize,
+                flags
+            };
+            uint32_t index = emit(collider);
+
+            for (uint32_t r = 0; r < height; r++) {
+                for (uint32_t c = 0; c < width; c++) {
+                    grid[(row + r) * numCols + col + c] = index;
+                }
+            }
+        }
+    }
+}
+
+#endif
@@ -3,6 +3,9 @@
 
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
+#include "RenderQueue.h"
+#include "GlyphAtlas.h"
+#include "SpriteSheet.h"
 #include <vector>
 #include <string>
 
@@ -32,14 +35,20 @@ public:
     bool init(int windowWidth, int windowHeight);
     void handleEvent(SDL_Event& e, GameState& state, bool& running);
     void update(float deltaTime);
-    void render(SDL_Renderer* renderer);
+    void render(RenderQueue& queue);
     void cleanup();
     
+    // Isi texture cache hilang (SDL_RENDER_TARGETS_RESET / DEVICE_RESET)
+    void invalidateCache();
+    
 private:
     // Fonts
     TTF_Font* titleFont;
     TTF_Font* itemFont;
     TTF_Font* smallFont;
+    GlyphAtlas titleText;
+    GlyphAtlas itemText;
+    GlyphAtlas smallText;
     
     // Menu state
     std::vector<MenuItem> items;
@@ -59,6 +68,21 @@ private:
     };
     std::vector<Cloud> clouds;
     
+    // Cache texture statis (langit, tanah, item normal/terpilih).
+    // Dibangun ulang hanya kalau ukuran window berubah lewat init.
+    struct ItemTextures {
+        SDL_Texture* normal;
+        SDL_Texture* selected;
+    };
+    SDL_Renderer* cacheRenderer;
+    SDL_Texture* skyTexture;
+    SDL_Texture* groundTexture;
+    std::vector<ItemTextures> itemTextures;
+    int cacheWidth;     // Ukuran window saat cache dibangun, 0 = perlu dibangun
+    int cacheHeight;
+    RenderQueue cacheQueue;
+    SpriteSheet sprites;        // Coin dan mushroom
+    
     // Input handling
     Uint32 lastKeyTime;
     static const Uint32 KEY_REPEAT_DELAY = 150;
@@ -69,19 +93,26 @@ private:
     void selectItem(GameState& state, bool& running);
     
     // Rendering
-    void renderBackground(SDL_Renderer* renderer);
-    void renderClouds(SDL_Renderer* renderer);
-    void renderGround(SDL_Renderer* renderer);
-    void renderTitle(SDL_Renderer* renderer);
-    void renderItems(SDL_Renderer* renderer);
-    void renderMenuItem(SDL_Renderer* renderer, MenuItem& item, bool isSelected);
-    void renderText(SDL_Renderer* renderer, const char* text, int x, int y, 
-                   TTF_Font* font, SDL_Color color, bool centered = true);
-    void renderCoin(SDL_Renderer* renderer, int x, int y, float rotation);
-    void renderMushroom(SDL_Renderer* renderer, int x, int y);
+    void renderBackground(RenderQueue& queue);
+    void renderClouds(RenderQueue& queue);
+    void renderGround(RenderQueue& queue);
+    void renderTitle(RenderQueue& queue);
+    void renderItems(RenderQueue& queue);
+    void renderMenuItem(RenderQueue& queue, size_t index, bool isSelected);
+    void composeMenuItem(RenderQueue& queue, int layer, const MenuItem& item, const SDL_Rect& r,
+                         bool isSelected, bool baked);
+    void renderText(RenderQueue& queue, int layer, const char* text, int x, int y, 
+                   GlyphAtlas& atlas, SDL_Color color, bool centered = true);
+    void renderCoin(RenderQueue& queue, int x, int y, float rotation);
+    void renderMushroom(RenderQueue& queue, int x, int y);
+    
+    // Cache
+    void buildCaches(SDL_Renderer* renderer);
+    void releaseCaches();
     
     // Utilities
     void initClouds();
+    void closeFonts();
     float easeInOutCubic(float t);
     SDL_Color lerpColor(SDL_Color a, SDL_Color b, float t);
 };
@@ -0,0 +1,64 @@
+#ifndef RENDERCANVAS_H
+#define RENDERCANVAS_H
+
+#include "SoftwareFramebuffer.h"
+#include <SDL2/SDL.h>
+
+// Resolusi logical game: level 20 baris x 32 pixel + tanah 80 pixel = 720
+const int LOGICAL_WIDTH = 1280;
+const int LOGICAL_HEIGHT = 720;
+
+enum CanvasScale {
+    CANVAS_NATIVE,      // Gambar langsung di resolusi output (tanpa target)
+    CANVAS_FIT,         // Skala pecahan terbesar yang muat, letterbox
+    CANVAS_INTEGER      // Skala bulat terbesar yang muat (pixel sama besar)
+};
+
+// Frame digambar ke texture LOGICAL_WIDTH x LOGICAL_HEIGHT lalu di-copy
+// sekali ke window dengan skala. Biaya fill game jadi sama di layar 1080p
+// maupun 4K; hanya copy akhir yang mengikuti ukuran output. Renderer
+// tanpa render target otomatis memakai CANVAS_NATIVE. Dengan
+// softwareRendering, canvas adalah SoftwareFramebuffer yang di-upload
+// sekali per frame.
+class RenderCanvas {
+public:
+    RenderCanvas();
+    ~RenderCanvas();
+
+    // Panggil ulang setelah ukuran window berubah (mode native)
+    bool init(SDL_Renderer* renderer, CanvasScale mode);
+    void release();
+
+    // Ukuran yang dipakai semua kode gambar
+    int width() const { return logicalWidth; }
+    int height() const { return logicalHeight; }
+    CanvasScale mode() const { return scaleMode; }
+
+    // Arahkan render ke canvas; present() copy ke window lalu SDL_RenderPresent
+    void begin();
+    void clear(SDL_Color color);
+    void present();
+
+    // nullptr kalau backend GPU; diberikan ke RenderQueue::setSoftware
+    SoftwareFramebuffer* software() { return useSoftware ? &framebuffer : nullptr; }
+
+    // Koordinat event mouse (point window) -> koordinat canvas
+    SDL_Point toLogical(int x, int y) const;
+
+private:
+    SDL_Renderer* renderer;
+    SDL_Texture* target;
+    CanvasScale scaleMode;
+    int logicalWidth;
+    int logicalHeight;
+    SoftwareFramebuffer framebuffer;
+    bool useSoftware;
+
+    // Posisi canvas di output renderer (pixel)
+    SDL_Rect outputRect() const;
+
+    RenderCanvas(const RenderCanvas&);
+    RenderCanvas& operator=(const RenderCanvas&);
+};
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+class SoftwareFramebuffer;
+
+struct RenderStats {
+    int commands;       // Item yang di-submit frame ini
+    int drawCalls;      // Panggilan draw SDL saat flush
+    int stateChanges;   // SDL_SetRenderDrawColor / texture mod yang benar-benar dipanggil
+};
+
+// Buffer perintah render. Kode game/menu men-submit item (rect, garis,
+// texture) dengan layer dan warna; flush() mengurutkan berdasarkan
+// (layer, jenis, texture, warna) lalu mengirimnya sebagai batch
+// SDL_RenderFillRects / SDL_RenderGeometry, tanpa ganti warna yang
+// tidak perlu.
+//
+// Urutan di dalam satu layer TIDAK dijamin: item yang saling menimpa
+// harus diberi layer berbeda (mis. badan enemy lalu matanya).
+class RenderQueue {
+public:
+    enum Kind {
+        KIND_FILL,
+        KIND_GEOMETRY,      // Quad berwarna per vertex / quad bertexture
+        KIND_LINE           // Garis miring (jarang)
+    };
+
+    // Dibaca juga oleh backend software (SoftwareFramebuffer)
+    struct Command {
+        int layer;
+        Kind kind;
+        SDL_Texture* texture;
+        Uint32 color;       // RGBA, untuk gradasi: warna atas
+        Uint32 color2;      // Warna bawah (gradasi)
+        SDL_Rect src;       // w = 0: seluruh texture
+        SDL_Rect rect;
+        unsigned order;
+    };
+
+    RenderQueue();
+    ~RenderQueue();
+
+    bool init(SDL_Renderer* renderer);
+    SDL_Renderer* renderer() const { return target; }
+
+    void fillRect(int layer, const SDL_Rect& rect, SDL_Color color);
+    // Outline 1 pixel (seperti SDL_RenderDrawRect), di-batch bersama fillRect
+    void drawRect(int layer, const SDL_Rect& rect, SDL_Color color);
+    void drawLine(int layer, int x0, int y0, int x1, int y1, SDL_Color color);
+    // Rect dengan gradasi vertikal (satu quad geometry)
+    void fillGradient(int layer, const SDL_Rect& rect, SDL_Color top, SDL_Color bottom);
+
+    // src nullptr = seluruh texture. ownTexture: texture sementara
+    // (mis. teks) yang dilepas setelah flush.
+    void copy(int layer, SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect& dst,
+              SDL_Color modulate, bool ownTexture = false);
+    void copy(int layer, SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect& dst) {
+        SDL_Color white = {255, 255, 255, 255};
+        copy(layer, texture, src, dst, white);
+    }
+
+    // Backend software: flush me-rasterize ke framebuffer CPU, bukan ke SDL
+    void setSoftware(SoftwareFramebuffer* framebuffer) { software = framebuffer; }
+    SoftwareFramebuffer* softwareTarget() const { return software; }
+
+    // Kirim semua item ke renderer dan kosongkan buffer
+    void flush();
+    void clear();
+
+    // Counter frame terakhir yang di-flush
+    const RenderStats& stats() const { return lastStats; }
+
+private:
+    SDL_Renderer* target;
+    SoftwareFramebuffer* software;
+    std::vector<Command> commands;
+    std::vector<unsigned> sorted;
+    std::vector<SDL_Texture*> ownedTextures;
+    RenderStats frameStats;
+    RenderStats lastStats;
+
+    // Scratch batch
+    std::vector<SDL_Rect> rectBatch;
+    std::vector<SDL_Vertex> vertexBatch;
+    std::vector<int> indexBatch;
+
+    bool hasColor;
+    Uint32 currentColor;
+
+    void push(int layer, Kind kind, SDL_Texture* texture, Uint32 color, Uint32 color2,
+              const SDL_Rect* src, const SDL_Rect& rect);
+    void setColor(Uint32 color);
+    void submitFills(size_t begin, size_t end);
+    void submitGeometry(size_t begin, size_t end);
+    void submitLines(size_t begin, size_t end);
+
+    static Uint32 packColor(SDL_Color c) {
+        return (static_cast<Uint32>(c.r) << 24) | (static_cast<Uint32>(c.g) << 16) |
+               (static_cast<Uint32>(c.b) << 8) | c.a;
+    }
+    static SDL_Color unpackColor(Uint32 c) {
+        SDL_Color color = {static_cast<Uint8>(c >> 24), static_cast<Uint8>(c >> 16),
+                           static_cast<Uint8>(c >> 8), static_cast<Uint8>(c)};
+        return color;
+    }
+
+    RenderQueue(const RenderQueue&);
+    RenderQueue& operator=(const RenderQueue&);
+};
+
+#endif
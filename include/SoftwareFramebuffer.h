@@ -0,0 +1,93 @@
+#ifndef SOFTWAREFRAMEBUFFER_H
+#define SOFTWAREFRAMEBUFFER_H
+
+#include "RenderQueue.h"
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Backend software aktif (--software, lihat main.cpp). Cache yang butuh
+// render target GPU memakai jalur gambar langsung kalau ini true.
+extern bool softwareRendering;
+
+// Salinan CPU texture (ARGB8888), lihat registerSoftwareImage
+struct SoftwareImage;
+
+// Isi texture SDL tidak bisa dibaca balik, jadi texture yang dibuat dari
+// surface (atlas glyph, sprite, langit/tanah menu) disimpan salinan
+// CPU-nya untuk backend software. Tidak melakukan apa-apa kalau
+// softwareRendering false.
+void registerSoftwareImage(SDL_Texture* texture, SDL_Surface* surface);
+void releaseSoftwareImage(SDL_Texture* texture);
+
+// Framebuffer CPU untuk mesin tanpa GPU. Frame di-rasterize langsung ke
+// buffer streaming texture (SDL_LockTexture), dibagi jadi band horizontal
+// yang dikerjakan paralel oleh thread pool. Fill dan alpha blend memakai
+// SSE2 (fallback scalar) dengan rumus yang sama dengan renderer software
+// SDL (x * a / 255), jadi pixel hasilnya sama.
+class SoftwareFramebuffer {
+public:
+    SoftwareFramebuffer();
+    ~SoftwareFramebuffer();
+
+    // threads = 0: sesuai jumlah core
+    bool init(SDL_Renderer* renderer, int width, int height, int threads = 0);
+    void release();
+
+    SDL_Texture* texture() const { return streaming; }
+    int width() const { return frameWidth; }
+    int height() const { return frameHeight; }
+    int threadCount() const { return static_cast<int>(workers.size()) + 1; }
+
+    // Kunci texture untuk frame baru; end() membuka kunci / upload
+    bool begin();
+    void end();
+
+    void clear(SDL_Color color);
+    // Gambar command yang sudah diurutkan RenderQueue
+    void draw(const std::vector<RenderQueue::Command>& commands, const std::vector<unsigned>& order);
+
+private:
+    struct DrawItem {
+        const RenderQueue::Command* command;
+        const SoftwareImage* image;     // nullptr untuk fill / gradasi / garis
+    };
+
+    SDL_Texture* streaming;
+    int frameWidth;
+    int frameHeight;
+    Uint32* pixels;             // Buffer texture terkunci, atau backBuffer
+    int pitch;                  // Dalam pixel
+    bool locked;
+    std::vector<Uint32> backBuffer;
+
+    // Job frame ini
+    std::vector<DrawItem> items;
+    SDL_Color clearColor;
+    bool clearPending;
+    int bandCount;
+    int bandHeight;
+
+    // Thread pool
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    unsigned generation;
+    int activeWorkers;
+    bool stopping;
+    std::atomic<int> nextBand;
+
+    void workerLoop();
+    void runBands();
+    void renderBands();
+    void renderBand(int y0, int y1);
+
+    SoftwareFramebuffer(const SoftwareFramebuffer&);
+    SoftwareFramebuffer& operator=(const SoftwareFramebuffer&);
+};
+
+#endif
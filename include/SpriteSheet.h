@@ -0,0 +1,62 @@
+#ifndef SPRITESHEET_H
+#define SPRITESHEET_H
+
+#include "RenderQueue.h"
+#include <SDL2/SDL.h>
+#include <vector>
+
+enum SpriteId {
+    SPRITE_PLAYER_RUN,      // Frame = legOffset + 3 (-3..3)
+    SPRITE_PLAYER_JUMP,
+    SPRITE_ENEMY,
+    SPRITE_COIN,            // Frame = lebar coin - 4 (4..16 pixel)
+    SPRITE_MENU_COIN,       // Frame = lebar coin (0..20 pixel)
+    SPRITE_MUSHROOM,
+    SPRITE_COUNT
+};
+
+// Semua bentuk prosedural entity (player, enemy, coin, mushroom menu)
+// termasuk setiap frame animasinya, di-bake sekali ke satu texture atlas.
+// Entity lalu digambar sebagai satu quad bertexture, sehingga semua
+// sprite satu frame masuk satu batch geometry di RenderQueue.
+class SpriteSheet {
+public:
+    SpriteSheet();
+    ~SpriteSheet();
+
+    bool init(SDL_Renderer* renderer);
+    void release();
+    bool valid() const { return texture != nullptr; }
+
+    static int frameCount(SpriteId id);
+
+    // (x, y) = titik acuan: pojok kiri atas rect untuk player/enemy, tengah
+    // untuk coin, tengah atas untuk mushroom. Sprite bisa melewati rect
+    // entity, mis. topi player di atas kepala.
+    void draw(RenderQueue& queue, int layer, SpriteId id, int frame, int x, int y,
+              SDL_Color modulate = SDL_Color{255, 255, 255, 255}) const;
+
+private:
+    struct Frame {
+        SDL_Rect src;
+        int offsetX;        // Posisi pojok kiri atas sprite relatif ke titik acuan
+        int offsetY;
+    };
+
+    // Satu rect berwarna dari bentuk sprite, koordinat relatif ke titik acuan
+    struct Part {
+        SDL_Rect rect;
+        SDL_Color color;
+    };
+
+    SDL_Texture* texture;
+    std::vector<Frame> frames;
+    int firstFrame[SPRITE_COUNT];
+
+    static void shape(SpriteId id, int frame, std::vector<Part>& parts);
+
+    SpriteSheet(const SpriteSheet&);
+    SpriteSheet& operator=(const SpriteSheet&);
+};
+
+#endif
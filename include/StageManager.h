@@ -0,0 +1,76 @@
+#ifndef STAGEMANAGER_H
+#define STAGEMANAGER_H
+
+#include "World.h"
+#include "ChunkSource.h"
+#include "LevelFile.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct StageInfo {
+    std::string name;       // "1-1"
+    std::string path;       // File .lvl (kosong = hanya level built-in)
+    LevelView builtIn;      // Fallback kalau file tidak ada (boleh tidak valid)
+};
+
+// Stage yang siap dimainkan: file .lvl sudah di-map, dan World-nya
+// sudah di-stream untuk layar pertama
+struct PreparedStage {
+    int index;
+    LevelFile file;
+    LevelView level;
+    std::unique_ptr<LevelChunkSource> source;
+    World world;
+    double prepareMs;
+};
+
+// Daftar stage berurutan. Selama satu stage dimainkan, stage
+// berikutnya disiapkan di worker thread (mmap, validasi, chunk dan
+// entity layar pertama), jadi pindah stage cukup menukar pointer.
+// Stage lama juga dilepas di worker, bukan di frame transisi.
+class StageManager {
+public:
+    StageManager();
+    ~StageManager();
+
+    void addStage(const std::string& name, const std::string& path, const LevelView& builtIn);
+    int stageCount() const { return static_cast<int>(stages.size()); }
+    const StageInfo& stage(int index) const { return stages[index]; }
+
+    // Siapkan stage pertama (blocking) dan mulai preload stage berikutnya
+    bool start(int first, int viewWidth, const StreamingConfig& config, std::string& error);
+
+    PreparedStage& current() { return *active; }
+    int currentIndex() const { return active ? active->index : -1; }
+
+    bool hasNext() const;
+    bool nextReady() const { return pendingReady.load(); }
+
+    // Pindah ke stage berikutnya. Kalau preload belum selesai
+    // (stage sangat pendek), tunggu worker-nya.
+    bool advance(std::string& error);
+
+private:
+    std::vector<StageInfo> stages;
+    int width;
+    StreamingConfig streaming;
+
+    std::unique_ptr<PreparedStage> active;
+    std::unique_ptr<PreparedStage> pending;     // Hanya disentuh worker sampai di-join
+    std::unique_ptr<PreparedStage> retired;     // Dilepas oleh worker berikutnya
+    std::string pendingError;
+    std::atomic<bool> pendingReady;
+    std::thread worker;
+
+    bool prepare(int index, PreparedStage& out, std::string& error) const;
+    void preload(int index);
+    void finishPreload();
+
+    StageManager(const StageManager&);
+    StageManager& operator=(const StageManager&);
+};
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef TILEMAP_H
+#define TILEMAP_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+#include "LevelFile.h"
+
+// Grid 2D untuk geometry statis level, di-index dengan (col, row).
+// Menggantikan std::vector<Platform>: collision dan render cukup melihat
+// cell yang relevan saja, bukan seluruh level.
+// Grid tile dan collider tidak di-copy: TileMap hanya menunjuk
+// ke data level (biasanya file .lvl yang di-mmap). State yang berubah
+// saat main (block yang sudah dipukul) disimpan di chunk, bukan di sini.
+class TileMap {
+public:
+    TileMap();
+
+    void attach(const LevelView& level);
+
+    int cols() const { return numCols; }
+    int rows() const { return numRows; }
+    int tileSize() const { return size; }
+    int widthPixels() const { return numCols * size; }
+
+    Uint8 tileAt(int col, int row) const;
+
+    // Collider hasil merge (lihat LevelCompiler), -1 kalau cell kosong
+    int colliderAt(int col, int row) const;
+    int colliderCount() const { return numColliders; }
+    SDL_Rect colliderRect(int index) const;
+    Uint32 colliderFlags(int index) const { return colliders[index].flags; }
+
+    bool isSolid(int col, int row) const { return colliderAt(col, row) >= 0; }
+
+    // Collider unik yang menyentuh area pixel
+    void collidersInArea(float x, float y, float w, float h, std::vector<int>& out) const;
+
+    // Rect world untuk cell (col, row)
+    SDL_Rect cellRect(int col, int row) const;
+
+    // Range cell (inklusif, sudah di-clamp) yang menyentuh area pixel
+    bool cellRange(float x, float y, float w, float h,
+                   int& col0, int& col1, int& row0, int& row1) const;
+    // Range kolom yang terlihat untuk area horizontal [x, x + w)
+    void columnRange(float x, float w, int& col0, int& col1) const;
+
+    int solidCount() const;
+
+private:
+    int numCols;
+    int numRows;
+    int size;
+    int numColliders;
+    const Uint8* tiles;
+    const LevelCollider* colliders;
+    const Uint32* colliderGrid;
+
+    bool inBounds(int col, int row) const {
+        return col >= 0 && col < numCols && row >= 0 && row < numRows;
+    }
+};
+
+#endif
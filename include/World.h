@@ -0,0 +1,214 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "GameBox.h"
+#include "Broadphase.h"
+#include "ChunkSource.h"
+#include "EntityStore.h"
+#include "FlagSet.h"
+#include <SDL2/SDL.h>
+#include <unordered_map>
+#include <vector>
+
+struct StreamingConfig {
+    int chunkCols;              // Lebar chunk dalam tile
+    int loadAheadPixels;        // Jarak di depan layar yang sudah disiapkan
+    int keepBehindPixels;       // Jarak di belakang kamera yang masih disimpan
+    size_t memoryBudget;        // Batas memory semua slot chunk (bytes)
+    int activeMarginPixels;     // Entity lebih jauh dari ini di luar layar tidur
+
+    StreamingConfig()
+        : chunkCols(32), loadAheadPixels(1024), keepBehindPixels(256),
+          memoryBudget(512 * 1024), activeMarginPixels(256) {}
+};
+
+struct StreamingStats {
+    int residentChunks;
+    size_t residentBytes;
+    int chunksBuilt;
+    int chunksEvicted;
+};
+
+struct ActivationStats {
+    int awakeEnemies;
+    int sleepingEnemies;
+    int awakeCoins;
+    int sleepingCoins;
+    int wakes;                  // Kumulatif sejak load
+    int sleeps;
+};
+
+// Referensi ke collider di chunk resident
+struct ColliderRef {
+    int slot;
+    int index;
+};
+
+class World;
+
+// Salinan tile chunk yang terlihat, untuk digambar di thread render
+// (lihat GameSnapshot.h). Salinan hanya berisi tile, colliderGrid, dan
+// platform; chunk yang revision-nya tidak berubah tidak disalin ulang.
+struct TileView {
+    const World* owner;         // Revision hanya unik di dalam satu World
+    int tileSize;
+    int groundY;
+    int chunkWidth;
+    int height;
+    std::vector<LevelChunk> chunks;
+    size_t chunkCount;          // chunks[0, chunkCount) terpakai, sisanya cadangan
+
+    TileView() : owner(nullptr), tileSize(0), groundY(0), chunkWidth(0), height(0), chunkCount(0) {}
+};
+
+// World yang di-stream per chunk. Hanya chunk di sekitar kamera yang
+// ada di memory; chunk lain dibangun ulang dari ChunkSource saat
+// didekati lagi. State permanen yang harus bertahan setelah chunk
+// di-evict (block yang sudah dipukul, coin yang sudah diambil, enemy
+// yang sudah mati) disimpan sebagai bitset, satu bit per cell / spawn,
+// jadi memory hanya tumbuh sedikit mengikuti panjang level. Di level
+// tanpa ujung, state chunk yang jauh di belakang window dibuang.
+//
+// Enemy dan coin dari chunk resident hidup di EntityStore (kolom
+// chunk = chunk tempatnya berada); user proxy broadphase berisi
+// EntityHandle-nya.
+class World {
+public:
+    World();
+
+    // Ground plane tepat di bawah baris terakhir level, tidak bergantung
+    // ukuran window
+    void load(ChunkSource* source, const StreamingConfig& config = StreamingConfig());
+    void clear();
+
+    // Bangun chunk yang didekati kamera, evict yang sudah lewat
+    void stream(float cameraX, int viewWidth);
+
+    // Source berubah di range pixel [x0, x1) (hot reload): chunk resident
+    // di range itu dibangun ulang, entity yang tidak berubah dipertahankan
+    void refreshRange(int x0, int x1);
+
+    int tileSize() const { return size; }
+    int rows() const { return source ? source->rows() : 0; }
+    int widthPixels() const { return source ? source->widthPixels() : 0; }
+    int chunkWidthPixels() const { return config.chunkCols * size; }
+    void playerStart(float& x, float& y) const { source->playerStart(x, y); }
+
+    // Ground plane di bawah level
+    int groundY() const { return groundTop; }
+    int groundHeight() const { return groundH; }
+    SDL_Rect groundRect(float fromX, float width) const;
+
+    // Geometry
+    void collidersInArea(float x, float y, float w, float h, std::vector<ColliderRef>& out) const;
+    Platform& platform(const ColliderRef& ref) { return slots[ref.slot].chunk.platforms[ref.index]; }
+    void hitBlock(Platform& block);
+
+    // Chunk resident (nullptr kalau belum dibangun)
+    const LevelChunk* chunkAt(int chunkIndex) const;
+    int chunkIndexOf(float x) const;
+    // Salin tile chunk resident di range pixel [x0, x1] ke out
+    void captureTiles(float x0, float x1, TileView& out) const;
+
+    // Entity
+    Broadphase& broadphase() { return phase; }
+    EntityStore& enemies() { return enemyStore; }
+    const EntityStore& enemies() const { return enemyStore; }
+    EntityStore& coins() { return coinStore; }
+    const EntityStore& coins() const { return coinStore; }
+    // Dihapus dari store; handle-nya tidak valid lagi
+    void collectCoin(EntityHandle coin);
+    void killEnemy(EntityHandle enemy);
+    void spawnCoin(int x, int y);
+
+    // Region aktif = layar + activeMarginPixels. Enemy dan coin di luar
+    // region tidur: tidak digerakkan dan tidak dianimasikan. Saat masuk
+    // lagi, enemy lanjut dari posisinya dan fase coin disusulkan.
+    void updateActivation(float cameraX, int viewWidth);
+
+    // Gerakkan enemy aktif, pindahkan ke chunk baru kalau lewat batas
+    void updateEnemies(float deltaTime);
+    void updateCoins(float deltaTime);
+
+    int activeEnemyCount() const;
+    int coinCount() const;
+    const StreamingStats& stats() const { return streamStats; }
+    const ActivationStats& activationStats() const { return activation; }
+
+private:
+    struct ChunkSlot {
+        bool used;
+        LevelChunk chunk;
+    };
+
+    ChunkSource* source;
+    StreamingConfig config;
+    int size;
+    int groundTop;
+    int groundH;
+
+    std::vector<ChunkSlot> slots;
+    std::unordered_map<int, int> residentSlot;   // chunk index -> slot
+    Broadphase phase;
+    EntityStore enemyStore;
+    EntityStore coinStore;
+    StreamingStats streamStats;
+    ActivationStats activation;
+    float entityClock;                           // Detik simulasi entity (updateCoins)
+    std::vector<int> activationScratch;
+    Uint32 nextRevision;
+
+    // State permanen, bitset rata. Kapasitas disiapkan waktu chunk
+    // di-stream (reservePersistent), jadi pickup / stomp / hit '?' tidak
+    // pernah mengalokasi.
+    FlagSet hitBlocks;                           // cellIndex(col, row)
+    FlagSet collectedCoins;                      // spawnId
+    FlagSet defeatedEnemies;                     // spawnId
+    FlagSet residentEnemies;                     // spawnId yang sedang hidup di chunk mana pun
+    int cellRows;                                // Jarak antar kolom di hitBlocks
+    int forgottenChunk;                          // Endless: state chunk sebelum ini sudah dibuang
+    FlagSet remapScratch;
+
+    // Coin dari '?' yang belum diambil waktu chunk-nya di-evict. Ring
+    // berkapasitas tetap: kalau penuh, yang paling lama dibuang (kamera
+    // tidak mundur, jadi itu yang paling jauh di belakang)
+    std::vector<Coin> looseCoins;
+    int looseHead;
+    int looseCount;
+
+    std::vector<int> wantedChunks;
+    LevelChunk refreshScratch;
+    std::vector<Coin> coinScratch;
+
+    int slotOf(int chunkIndex) const;
+    void touchChunk(LevelChunk& chunk) { chunk.revision = ++nextRevision; }
+    int acquireSlot();
+    bool buildChunk(int chunkIndex);
+    void evictSlot(int slot);
+    void releaseSlot(int slot);
+    void applyPersistentState(int slot);
+    void applyHitState(LevelChunk& chunk);
+    void refreshSlot(int slot);
+    void registerEntities(int slot);
+    void addEnemy(const Enemy& spawn, int chunkIndex);
+    void addCoin(const Coin& spawn, int chunkIndex);
+    // Swap-remove enemy / coin di index dense beserta proxy-nya
+    void removeEnemy(int index);
+    void removeCoin(int index);
+    void pushLooseCoin(const Coin& coin);
+    void sleepOutside(EntityStore& store, bool enemies, const SDL_Rect& region);
+    size_t slotBytes(const ChunkSlot& s) const;
+    size_t residentBytes() const;
+    void enforceBudget(int firstVisible, int lastVisible, float cameraX);
+
+    void reservePersistent(const LevelChunk& chunk);
+    void remapHitBlocks(int rows);
+    void forgetBefore(int chunkIndex);
+
+    // Column-major: level endless cukup menambah kolom di belakang
+    int cellIndex(int col, int row) const {
+        return col >= 0 && row >= 0 && row < cellRows ? col * cellRows + row : -1;
+    }
+};
+
+#endif
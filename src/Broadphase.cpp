@@ -0,0 +1,190 @@
+#include "Broadphase.h"
+#include <algorithm>
+
+static bool boxesOverlap(const SDL_Rect& a, const SDL_Rect& b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w &&
+           a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+Broadphase::Broadphase(int cellWidth)
+    : cellWidth(cellWidth), currentStamp(0) {
+}
+
+void Broadphase::clear() {
+    proxies.clear();
+    freeIds.clear();
+    cells.clear();
+    stamps.clear();
+    currentStamp = 0;
+}
+
+int Broadphase::cellOf(int x) const {
+    // Floor division supaya koordinat negatif tetap benar
+    return x >= 0 ? x / cellWidth : -((-x + cellWidth - 1) / cellWidth);
+}
+
+void Broadphase::insertCells(int id) {
+    const BroadphaseProxy& p = proxies[id];
+    for (int c = p.cell0; c <= p.cell1; c++) {
+        cells[c].push_back(id);
+    }
+}
+
+void Broadphase::removeCells(int id) {
+    const BroadphaseProxy& p = proxies[id];
+    for (int c = p.cell0; c <= p.cell1; c++) {
+        auto it = cells.find(c);
+        if (it == cells.end()) continue;
+
+        std::vector<int>& bucket = it->second;
+        for (size_t i = 0; i < bucket.size(); i++) {
+            if (bucket[i] == id) {
+                bucket[i] = bucket.back();
+                bucket.pop_back();
+                break;
+            }
+        }
+        // Bucket kosong tidak dihapus: masuk lagi ke cell ini tidak
+        // mengalokasi node map dan buffer vector baru
+    }
+}
+
+void Broadphase::reserveCells(int x0, int x1) {
+    for (int c = cellOf(x0); c <= cellOf(x1 - 1); c++) {
+        std::vector<int>& bucket = cells[c];
+        if (bucket.capacity() < BUCKET_RESERVE) bucket.reserve(BUCKET_RESERVE);
+    }
+}
+
+void Broadphase::releaseCells(int x0, int x1) {
+    // Hanya cell yang seluruhnya di dalam range, supaya bucket yang
+    // dipakai bersama chunk tetangga tetap ada
+    for (int c = cellOf(x0 + cellWidth - 1); c < cellOf(x1); c++) {
+        auto it = cells.find(c);
+        if (it != cells.end() && it->second.empty()) cells.erase(it);
+    }
+}
+
+int Broadphase::add(const SDL_Rect& box, int layer, int user) {
+    int id;
+    if (!freeIds.empty()) {
+        id = freeIds.back();
+        freeIds.pop_back();
+    } else {
+        id = static_cast<int>(proxies.size());
+        proxies.push_back(BroadphaseProxy());
+        stamps.push_back(0);
+        // Cukup untuk semua proxy, jadi remove() tidak pernah mengalokasi
+        freeIds.reserve(proxies.capacity());
+    }
+
+    BroadphaseProxy& p = proxies[id];
+    p.box = box;
+    p.cell0 = cellOf(box.x);
+    p.cell1 = cellOf(box.x + box.w - 1);
+    p.layer = layer;
+    p.user = user;
+    p.alive = true;
+
+    insertCells(id);
+    return id;
+}
+
+void Broadphase::move(int id, const SDL_Rect& box) {
+    if (id < 0 || id >= static_cast<int>(proxies.size())) return;
+    BroadphaseProxy& p = proxies[id];
+    if (!p.alive) return;
+
+    p.box = box;
+    int c0 = cellOf(box.x);
+    int c1 = cellOf(box.x + box.w - 1);
+    if (c0 == p.cell0 && c1 == p.cell1) return;  // Masih di cell yang sama
+
+    removeCells(id);
+    p.cell0 = c0;
+    p.cell1 = c1;
+    insertCells(id);
+}
+
+void Broadphase::remove(int id) {
+    if (id < 0 || id >= static_cast<int>(proxies.size())) return;
+    if (!proxies[id].alive) return;
+
+    removeCells(id);
+    proxies[id].alive = false;
+    freeIds.push_back(id);
+}
+
+void Broadphase::setUser(int id, int user) {
+    if (id < 0 || id >= static_cast<int>(proxies.size())) return;
+    proxies[id].user = user;
+}
+
+void Broadphase::query(const SDL_Rect& area, Uint32 layerMask, std::vector<int>& out) const {
+    out.clear();
+    if (++currentStamp == 0) {
+        // Stamp overflow - reset semua
+        std::fill(stamps.begin(), stamps.end(), 0);
+        currentStamp = 1;
+    }
+
+    int c0 = cellOf(area.x);
+    int c1 = cellOf(area.x + area.w - 1);
+
+    for (int c = c0; c <= c1; c++) {
+        auto it = cells.find(c);
+        if (it == cells.end()) continue;
+
+        for (int id : it->second) {
+            if (stamps[id] == currentStamp) continue;
+            stamps[id] = currentStamp;
+
+            const BroadphaseProxy& p = proxies[id];
+            if (!(layerMask & bpMask(p.layer))) continue;
+            if (!boxesOverlap(area, p.box)) continue;
+            out.push_back(id);
+        }
+    }
+}
+
+void Broadphase::findPairs(int layerA, int layerB, std::vector<std::pair<int, int> >& out) const {
+    out.clear();
+    std::vector<int>& candidates = pairScratch;
+
+    for (const auto& entry : cells) {
+        int cell = entry.first;
+
+        // Saring dulu berdasarkan layer, supaya bucket penuh coin
+        // tidak membuat loop pasangan jadi kuadratik
+        candidates.clear();
+        for (int id : entry.second) {
+            int layer = proxies[id].layer;
+            if (layer == layerA || layer == layerB) candidates.push_back(id);
+        }
+
+        for (size_t i = 0; i < candidates.size(); i++) {
+            const BroadphaseProxy& a = proxies[candidates[i]];
+
+            for (size_t j = i + 1; j < candidates.size(); j++) {
+                const BroadphaseProxy& b = proxies[candidates[j]];
+
+                bool match = (a.layer == layerA && b.layer == layerB) ||
+                             (a.layer == layerB && b.layer == layerA);
+                if (!match) continue;
+
+                // Pasangan yang berbagi beberapa cell hanya dilaporkan
+                // di cell pertama yang mereka tempati bersama
+                int firstShared = a.cell0 > b.cell0 ? a.cell0 : b.cell0;
+                if (firstShared != cell) continue;
+
+                if (!boxesOverlap(a.box, b.box)) continue;
+
+                if (a.layer == layerA) {
+                    out.push_back(std::make_pair(candidates[i], candidates[j]));
+                } else {
+                    out.push_back(std::make_pair(candidates[j], candidates[i]));
+                }
+            }
+        }
+    }
+}
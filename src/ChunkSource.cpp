@@ -0,0 +1,126 @@
+#include "ChunkSource.h"
+#include <algorithm>
+
+// Enemy hitbox (lihat GameScene)
+static const int ENEMY_SIZE = 28;
+
+void resetChunk(LevelChunk& chunk, int index, int startX, int cols, int rows, int tileSize) {
+    chunk.platforms.clear();
+    chunk.coins.clear();
+    chunk.enemies.clear();
+    chunk.index = index;
+    chunk.startX = startX;
+    chunk.width = cols * tileSize;
+    chunk.cols = cols;
+    chunk.rows = rows;
+    chunk.revision = 0;
+    chunk.tiles.assign(static_cast<size_t>(cols) * rows, TILE_EMPTY);
+    chunk.colliderGrid.assign(static_cast<size_t>(cols) * rows, CHUNK_NO_COLLIDER);
+}
+
+void indexChunkColliders(LevelChunk& chunk, int tileSize) {
+    std::fill(chunk.colliderGrid.begin(), chunk.colliderGrid.end(), CHUNK_NO_COLLIDER);
+
+    for (size_t i = 0; i < chunk.platforms.size(); i++) {
+        const SDL_Rect& r = chunk.platforms[i].rect;
+        int col0 = (r.x - chunk.startX) / tileSize;
+        int col1 = (r.x + r.w - 1 - chunk.startX) / tileSize;
+        int row0 = r.y / tileSize;
+        int row1 = (r.y + r.h - 1) / tileSize;
+
+        for (int row = std::max(row0, 0); row <= std::min(row1, chunk.rows - 1); row++) {
+            for (int col = std::max(col0, 0); col <= std::min(col1, chunk.cols - 1); col++) {
+                chunk.colliderGrid[row * chunk.cols + col] = static_cast<Uint16>(i);
+            }
+        }
+    }
+}
+
+Coin makeCoin(const LevelCoinSpawn& spawn, int offsetX, int spawnId) {
+    Coin c = {spawn.x + offsetX, spawn.y, false, 0.0f, spawnId};
+    return c;
+}
+
+Enemy makeEnemy(const LevelEnemySpawn& spawn, int offsetX, int spawnId) {
+    Enemy e;
+    e.x = static_cast<float>(spawn.x + offsetX);
+    e.y = static_cast<float>(spawn.y);
+    e.vx = static_cast<float>(spawn.vx);
+    e.rect = {spawn.x + offsetX, spawn.y, ENEMY_SIZE, ENEMY_SIZE};
+    e.active = true;
+    e.leftBound = 0.0f;
+    e.rightBound = 0.0f;
+    e.spawnId = spawnId;
+    return e;
+}
+
+// ========================================
+// LevelChunkSource
+// ========================================
+
+LevelChunkSource::LevelChunkSource(const LevelView& levelView)
+    : level(levelView) {
+    tileMap.attach(level);
+}
+
+void LevelChunkSource::playerStart(float& x, float& y) const {
+    x = static_cast<float>(level.header->playerX);
+    y = static_cast<float>(level.header->playerY);
+}
+
+bool LevelChunkSource::buildChunk(int index, int chunkCols, LevelChunk& chunk) {
+    int size = tileMap.tileSize();
+    int col0 = index * chunkCols;
+    int cols = std::min(chunkCols, tileMap.cols() - col0);
+    if (index < 0 || cols <= 0) {
+        resetChunk(chunk, index, col0 * size, 0, tileMap.rows(), size);
+        return true;
+    }
+
+    resetChunk(chunk, index, col0 * size, cols, tileMap.rows(), size);
+    int endX = chunk.startX + chunk.width;
+
+    // Tile - copy per baris dari grid level
+    for (int row = 0; row < chunk.rows; row++) {
+        for (int col = 0; col < cols; col++) {
+            chunk.tiles[row * cols + col] = tileMap.tileAt(col0 + col, row);
+        }
+    }
+
+    // Collider hasil merge, dipotong di batas chunk
+    tileMap.collidersInArea(static_cast<float>(chunk.startX), 0.0f,
+                            static_cast<float>(chunk.width - 1),
+                            static_cast<float>(chunk.rows * size - 1), colliderScratch);
+    for (int id : colliderScratch) {
+        SDL_Rect r = tileMap.colliderRect(id);
+        int left = std::max(r.x, chunk.startX);
+        int right = std::min(r.x + r.w, endX);
+
+        Platform p;
+        p.rect = {left, r.y, right - left, r.h};
+        p.isBreakable = (tileMap.colliderFlags(id) & LEVEL_COLLIDE_BUMP) != 0;
+        p.isBrick = !p.isBreakable;
+        p.isHit = false;
+        chunk.platforms.push_back(p);
+    }
+    indexChunkColliders(chunk, size);
+
+    // Spawn table sudah urut x, cukup binary search range chunk
+    const LevelCoinSpawn* coinsBegin = level.coins;
+    const LevelCoinSpawn* coinsEnd = level.coins + level.coinCount();
+    const LevelCoinSpawn* coin = std::lower_bound(coinsBegin, coinsEnd, chunk.startX,
+        [](const LevelCoinSpawn& c, int x) { return c.x < x; });
+    for (; coin != coinsEnd && coin->x < endX; ++coin) {
+        chunk.coins.push_back(makeCoin(*coin, 0, static_cast<int>(coin - coinsBegin)));
+    }
+
+    const LevelEnemySpawn* enemiesBegin = level.enemies;
+    const LevelEnemySpawn* enemiesEnd = level.enemies + level.enemyCount();
+    const LevelEnemySpawn* spawn = std::lower_bound(enemiesBegin, enemiesEnd, chunk.startX,
+        [](const LevelEnemySpawn& e, int x) { return e.x < x; });
+    for (; spawn != enemiesEnd && spawn->x < endX; ++spawn) {
+        chunk.enemies.push_back(makeEnemy(*spawn, 0, static_cast<int>(spawn - enemiesBegin)));
+    }
+
+    return true;
+}
@@ -0,0 +1,178 @@
+#include "ChunkTextureCache.h"
+#include "SoftwareFramebuffer.h"
+#include <algorithm>
+#include <cmath>
+
+void drawChunkTiles(RenderQueue& queue, int layer, const LevelChunk& chunk, int col0, int col1,
+                    int offsetX, int groundY, int tileSize) {
+    const SDL_Color black = {0, 0, 0, 255};
+
+    for (int row = 0; row < chunk.rows; row++) {
+        for (int col = col0; col <= col1; col++) {
+            Uint8 tile = chunk.tiles[row * chunk.cols + col];
+            if (tile == TILE_EMPTY) continue;
+
+            SDL_Rect screenRect = {offsetX + col * tileSize, row * tileSize, tileSize, tileSize};
+
+            if (tile == TILE_QUESTION) {
+                // Question block
+                Uint16 collider = chunk.colliderGrid[row * chunk.cols + col];
+                if (collider != CHUNK_NO_COLLIDER && chunk.platforms[collider].isHit) {
+                    // Used block
+                    queue.fillRect(layer, screenRect, SDL_Color{160, 130, 90, 255});
+                    queue.drawRect(layer + 1, screenRect, black);
+                } else {
+                    // Active question block
+                    queue.fillRect(layer, screenRect, SDL_Color{243, 168, 59, 255});
+                    queue.drawRect(layer + 1, screenRect, black);
+
+                    // Draw "?"
+                    SDL_Rect qmark = {screenRect.x + 12, screenRect.y + 8, 8, 16};
+                    queue.fillRect(layer + 1, qmark, black);
+                }
+            }
+            else if (row * tileSize >= groundY - 5) {
+                // Ground style untuk block yang menempel ke tanah
+                SDL_Rect grass = {screenRect.x, screenRect.y, screenRect.w, 20};
+                queue.fillRect(layer, grass, SDL_Color{123, 192, 67, 255});
+
+                SDL_Rect dirt = {screenRect.x, screenRect.y + 20, screenRect.w, screenRect.h - 20};
+                queue.fillRect(layer, dirt, SDL_Color{139, 90, 43, 255});
+            } else {
+                // Floating platform or placed blocks
+                queue.fillRect(layer, screenRect, SDL_Color{184, 111, 80, 255});
+                queue.drawRect(layer + 1, screenRect, black);
+            }
+        }
+    }
+}
+
+ChunkTextureCache::ChunkTextureCache(SDL_Renderer* r)
+    : renderer(r), owner(nullptr), targetsSupported(SDL_RenderTargetSupported(r) == SDL_TRUE && !softwareRendering),
+      textureWidth(0), textureHeight(0) {
+    redrawQueue.init(renderer);
+    frameStats = {0, 0, 0, 0};
+}
+
+ChunkTextureCache::~ChunkTextureCache() {
+    destroyTextures();
+}
+
+void ChunkTextureCache::destroyTextures() {
+    for (auto& entry : entries) {
+        if (entry.texture) SDL_DestroyTexture(entry.texture);
+    }
+    entries.clear();
+}
+
+void ChunkTextureCache::invalidate() {
+    for (auto& entry : entries) {
+        entry.chunkIndex = -1;
+        entry.revision = 0;
+    }
+}
+
+void ChunkTextureCache::releaseStale(const TileView& tiles) {
+    for (auto& entry : entries) {
+        if (entry.chunkIndex < 0) continue;
+
+        bool visible = false;
+        for (size_t i = 0; i < tiles.chunkCount && !visible; i++) {
+            visible = tiles.chunks[i].index == entry.chunkIndex;
+        }
+        if (!visible) {
+            entry.chunkIndex = -1;
+            entry.revision = 0;
+        }
+    }
+}
+
+ChunkTextureCache::Entry* ChunkTextureCache::entryFor(int chunkIndex) {
+    Entry* unused = nullptr;
+    for (auto& entry : entries) {
+        if (entry.chunkIndex == chunkIndex) return &entry;
+        if (entry.chunkIndex < 0 && !unused) unused = &entry;
+    }
+
+    if (!unused) {
+        SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                                 textureWidth, textureHeight);
+        if (!texture) {
+            // Mis. kehabisan memory texture: pakai jalur langsung seterusnya
+            targetsSupported = false;
+            return nullptr;
+        }
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+        Entry entry = {-1, 0, texture};
+        entries.push_back(entry);
+        unused = &entries.back();
+    }
+
+    // Revision 0 tidak pernah dipakai World, jadi chunk pasti digambar
+    unused->chunkIndex = chunkIndex;
+    unused->revision = 0;
+    return unused;
+}
+
+void ChunkTextureCache::redraw(Entry& entry, const LevelChunk& chunk, int groundY, int tileSize) {
+    SDL_Texture* previous = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, entry.texture);
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    drawChunkTiles(redrawQueue, 0, chunk, 0, chunk.cols - 1, 0, groundY, tileSize);
+    redrawQueue.flush();
+
+    SDL_SetRenderTarget(renderer, previous);
+    entry.revision = chunk.revision;
+    frameStats.redrawnChunks++;
+}
+
+void ChunkTextureCache::draw(RenderQueue& queue, int layer, const TileView& tiles, float cameraX, int viewWidth) {
+    frameStats = {0, 0, 0, 0};
+
+    // Revision hanya unik di dalam satu World
+    if (tiles.owner != owner) {
+        owner = tiles.owner;
+        invalidate();
+    }
+
+    int tileSize = tiles.tileSize;
+    int groundY = tiles.groundY;
+    int width = tiles.chunkWidth;
+    int height = tiles.height;
+    if (width != textureWidth || height != textureHeight) {
+        destroyTextures();
+        textureWidth = width;
+        textureHeight = height;
+    }
+    releaseStale(tiles);
+
+    float viewX0 = cameraX;
+    float viewX1 = cameraX + viewWidth;
+
+    for (size_t i = 0; i < tiles.chunkCount; i++) {
+        const LevelChunk* chunk = &tiles.chunks[i];
+        if (chunk->startX + chunk->width <= viewX0 || chunk->startX >= viewX1) continue;
+        frameStats.visibleChunks++;
+
+        int screenX = static_cast<int>(std::floor(chunk->startX - cameraX));
+        Entry* entry = targetsSupported ? entryFor(chunk->index) : nullptr;
+
+        if (entry) {
+            if (entry->revision != chunk->revision) redraw(*entry, *chunk, groundY, tileSize);
+
+            SDL_Rect src = {0, 0, chunk->width, height};
+            SDL_Rect dst = {screenX, 0, chunk->width, height};
+            queue.copy(layer, entry->texture, &src, dst);
+            frameStats.textureCopies++;
+        } else {
+            // Renderer tanpa render target: hanya kolom yang terlihat
+            int col0 = std::max(static_cast<int>(std::floor((viewX0 - chunk->startX) / tileSize)), 0);
+            int col1 = std::min(static_cast<int>(std::floor((viewX1 - chunk->startX) / tileSize)), chunk->cols - 1);
+            drawChunkTiles(queue, layer, *chunk, col0, col1, screenX, groundY, tileSize);
+            frameStats.directTiles += (col1 - col0 + 1) * chunk->rows;
+        }
+    }
+}
@@ -0,0 +1,271 @@
+#include "EditableLevel.h"
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include <sstream>
+
+// Baris level maksimal (lihat spawnKey)
+static const int MAX_ROWS = 256;
+
+static bool readLevelLines(const std::string& path, std::vector<std::string>& out, std::string& error) {
+    std::ifstream in(path);
+    if (!in) {
+        error = "cannot open " + path;
+        return false;
+    }
+
+    out.clear();
+    std::string line;
+    while (std::getline(in, line)) {
+        // File dari Windows
+        if (!line.empty() && line[line.size() - 1] == '\r') {
+            line.erase(line.size() - 1);
+        }
+        out.push_back(line);
+    }
+
+    if (out.empty()) {
+        error = "level is empty";
+        return false;
+    }
+    if (static_cast<int>(out.size()) > MAX_ROWS) {
+        error = "level has too many rows";
+        return false;
+    }
+    return true;
+}
+
+static char charAt(const std::string& line, int col) {
+    return col < static_cast<int>(line.length()) ? line[col] : ' ';
+}
+
+static std::string cellError(int col, int row, const std::string& what) {
+    std::ostringstream msg;
+    msg << "row " << row + 1 << ", col " << col + 1 << ": " << what;
+    return msg.str();
+}
+
+EditableLevelSource::EditableLevelSource(int tileSize)
+    : size(tileSize), numCols(0), numRows(0), playerCol(0), playerRow(0) {
+}
+
+void EditableLevelSource::playerStart(float& x, float& y) const {
+    x = static_cast<float>(playerCol * size);
+    y = static_cast<float>(playerRow * size);
+}
+
+void EditableLevelSource::setCell(int col, int row, char c) {
+    tiles[col * numRows + row] = levelTileFor(c);
+
+    int key = spawnKey(col, row);
+    spawns.erase(key);
+
+    switch (classifyLevelChar(c)) {
+        case LEVEL_CHAR_COIN:
+        case LEVEL_CHAR_ENEMY:
+            spawns[key] = c;
+            break;
+        case LEVEL_CHAR_PLAYER:
+            playerCol = col;
+            playerRow = row;
+            break;
+        default:
+            break;
+    }
+}
+
+bool EditableLevelSource::load(const std::string& levelPath, std::string& error) {
+    std::vector<std::string> newLines;
+    if (!readLevelLines(levelPath, newLines, error)) return false;
+
+    int newCols = 0;
+    int players = 0;
+    for (int row = 0; row < static_cast<int>(newLines.size()); row++) {
+        const std::string& line = newLines[row];
+        newCols = std::max(newCols, static_cast<int>(line.length()));
+
+        for (int col = 0; col < static_cast<int>(line.length()); col++) {
+            LevelChar kind = classifyLevelChar(line[col]);
+            if (kind == LEVEL_CHAR_INVALID) {
+                error = cellError(col, row, std::string("unknown tile '") + line[col] + "'");
+                return false;
+            }
+            if (kind == LEVEL_CHAR_PLAYER && ++players > 1) {
+                error = cellError(col, row, "duplicate player start 'P'");
+                return false;
+            }
+        }
+    }
+    if (players == 0) {
+        error = "level has no player start 'P'";
+        return false;
+    }
+
+    path = levelPath;
+    numRows = static_cast<int>(newLines.size());
+    numCols = newCols;
+    tiles.assign(static_cast<size_t>(numCols) * numRows, TILE_EMPTY);
+    spawns.clear();
+
+    for (int row = 0; row < numRows; row++) {
+        for (int col = 0; col < static_cast<int>(newLines[row].length()); col++) {
+            setCell(col, row, newLines[row][col]);
+        }
+    }
+
+    lines.swap(newLines);
+    return true;
+}
+
+bool EditableLevelSource::reload(int& dirtyX0, int& dirtyX1, int& changedCells, std::string& error) {
+    dirtyX0 = dirtyX1 = 0;
+    changedCells = 0;
+
+    std::vector<std::string> newLines;
+    if (!readLevelLines(path, newLines, error)) return false;
+
+    // Jumlah baris berubah: posisi semua tile bergeser, load ulang penuh
+    if (static_cast<int>(newLines.size()) != numRows) {
+        int oldWidth = widthPixels();
+        if (!load(path, error)) return false;
+        dirtyX0 = 0;
+        dirtyX1 = std::max(oldWidth, widthPixels());
+        changedCells = numCols * numRows;
+        return true;
+    }
+
+    // Diff per baris: hanya range kolom di antara karakter pertama
+    // dan terakhir yang berbeda yang diperiksa per cell
+    int newCols = 0;
+    changedScratch.clear();
+    for (int row = 0; row < numRows; row++) {
+        const std::string& oldLine = lines[row];
+        const std::string& newLine = newLines[row];
+        newCols = std::max(newCols, static_cast<int>(newLine.length()));
+        if (oldLine == newLine) continue;
+
+        int width = static_cast<int>(std::max(oldLine.length(), newLine.length()));
+        int first = 0;
+        while (first < width && charAt(oldLine, first) == charAt(newLine, first)) first++;
+        int last = width - 1;
+        while (last > first && charAt(oldLine, last) == charAt(newLine, last)) last--;
+
+        for (int col = first; col <= last; col++) {
+            if (charAt(oldLine, col) != charAt(newLine, col)) {
+                changedScratch.push_back(std::make_pair(col, row));
+            }
+        }
+    }
+
+    // Validasi dulu - edit yang rusak tidak boleh setengah diterapkan
+    bool playerKept = true;
+    int newPlayers = 0;
+    for (const auto& cell : changedScratch) {
+        char c = charAt(newLines[cell.second], cell.first);
+        LevelChar kind = classifyLevelChar(c);
+        if (kind == LEVEL_CHAR_INVALID) {
+            error = cellError(cell.first, cell.second, std::string("unknown tile '") + c + "'");
+            return false;
+        }
+        if (kind == LEVEL_CHAR_PLAYER) newPlayers++;
+        if (cell.first == playerCol && cell.second == playerRow && kind != LEVEL_CHAR_PLAYER) playerKept = false;
+    }
+    int players = newPlayers + (playerKept ? 1 : 0);
+    if (players == 0) {
+        error = "level has no player start 'P'";
+        return false;
+    }
+    if (players > 1) {
+        error = "duplicate player start 'P'";
+        return false;
+    }
+
+    // Tile column-major: level yang melebar/menyempit cukup resize di ujung
+    int oldCols = numCols;
+    if (newCols > numCols) {
+        tiles.resize(static_cast<size_t>(newCols) * numRows, TILE_EMPTY);
+        numCols = newCols;
+    }
+
+    // Kolom yang ditambah/dibuang ikut dirty walau isinya kosong
+    int col0 = INT_MAX;
+    int col1 = -1;
+    if (newCols != oldCols) {
+        col0 = std::min(oldCols, newCols);
+        col1 = std::max(oldCols, newCols) - 1;
+    }
+    for (const auto& cell : changedScratch) {
+        setCell(cell.first, cell.second, charAt(newLines[cell.second], cell.first));
+        col0 = std::min(col0, cell.first);
+        col1 = std::max(col1, cell.first);
+    }
+
+    if (newCols < numCols) {
+        tiles.resize(static_cast<size_t>(newCols) * numRows);
+        numCols = newCols;
+    }
+
+    lines.swap(newLines);
+    changedCells = static_cast<int>(changedScratch.size());
+    if (col0 <= col1) {
+        dirtyX0 = col0 * size;
+        dirtyX1 = (col1 + 1) * size;
+    }
+    return true;
+}
+
+bool EditableLevelSource::buildChunk(int index, int chunkCols, LevelChunk& chunk) {
+    int col0 = index * chunkCols;
+    int cols = std::min(chunkCols, numCols - col0);
+    if (index < 0 || cols <= 0) {
+        resetChunk(chunk, index, col0 * size, 0, numRows, size);
+        return true;
+    }
+
+    resetChunk(chunk, index, col0 * size, cols, numRows, size);
+
+    for (int col = 0; col < cols; col++) {
+        const Uint8* column = &tiles[(col0 + col) * numRows];
+        for (int row = 0; row < numRows; row++) {
+            chunk.tiles[row * cols + col] = column[row];
+        }
+    }
+
+    // Collider di-merge per chunk, dari tile chunk saja
+    gridScratch.assign(chunk.tiles.size(), LEVEL_NO_COLLIDER);
+    std::vector<Platform>& platforms = chunk.platforms;
+    int startX = chunk.startX;
+    auto emit = [&platforms, startX](const LevelCollider& c) {
+        Platform p;
+        p.rect = {c.x + startX, c.y, c.w, c.h};
+        p.isBreakable = (c.flags & LEVEL_COLLIDE_BUMP) != 0;
+        p.isBrick = !p.isBreakable;
+        p.isHit = false;
+        platforms.push_back(p);
+        return static_cast<uint32_t>(platforms.size() - 1);
+    };
+    mergeLevelColliders(chunk.tiles, static_cast<uint32_t>(cols), static_cast<uint32_t>(numRows),
+                        size, gridScratch, emit);
+    for (size_t i = 0; i < gridScratch.size(); i++) {
+        chunk.colliderGrid[i] = gridScratch[i] == LEVEL_NO_COLLIDER ? CHUNK_NO_COLLIDER
+                                                                     : static_cast<Uint16>(gridScratch[i]);
+    }
+
+    // Spawn urut kolom, cukup ambil range kolom chunk
+    std::map<int, char>::const_iterator it = spawns.lower_bound(spawnKey(col0, 0));
+    std::map<int, char>::const_iterator end = spawns.lower_bound(spawnKey(col0 + cols, 0));
+    for (; it != end; ++it) {
+        int x = (it->first >> 8) * size;
+        int y = (it->first & 0xFF) * size;
+
+        if (it->second == 'C') {
+            LevelCoinSpawn spawn = {x + size / 2, y + size / 2};
+            chunk.coins.push_back(makeCoin(spawn, 0, it->first));
+        } else {
+            LevelEnemySpawn spawn = {x, y, levelEnemySpeedFor(it->second)};
+            chunk.enemies.push_back(makeEnemy(spawn, 0, it->first));
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,140 @@
+#include "EntityStore.h"
+#include <utility>
+
+EntityStore::EntityStore()
+    : awake(0) {
+}
+
+template <typename Function>
+void EntityStore::forEachColumn(Function function) {
+    function(x);
+    function(y);
+    function(prevX);
+    function(prevY);
+    function(vx);
+    function(vy);
+    function(animPhase);
+    function(width);
+    function(height);
+    function(proxy);
+    function(spawnId);
+    function(chunk);
+    function(homeChunk);
+    function(value);
+    function(spawnTime);
+    function(sleptAt);
+    function(handles);
+}
+
+void EntityStore::clear() {
+    // Capacity dipertahankan untuk level / stage berikutnya
+    forEachColumn([](auto& column) { column.clear(); });
+    denseIndex.clear();
+    generations.clear();
+    liveBits.clear();
+    freeIndices.clear();
+    awake = 0;
+}
+
+void EntityStore::reserve(int capacity) {
+    forEachColumn([capacity](auto& column) { column.reserve(capacity); });
+    denseIndex.reserve(capacity);
+    generations.reserve(capacity);
+    liveBits.reserve((capacity + 63) / 64);
+    freeIndices.reserve(capacity);
+}
+
+EntityHandle EntityStore::create(float posX, float posY) {
+    int index;
+    if (!freeIndices.empty()) {
+        index = freeIndices.back();
+        freeIndices.pop_back();
+    } else {
+        index = static_cast<int>(denseIndex.size());
+        denseIndex.push_back(-1);
+        generations.push_back(0);
+        if (static_cast<size_t>(index >> 6) >= liveBits.size()) liveBits.push_back(0);
+    }
+
+    EntityHandle handle = (generations[index] << INDEX_BITS) | index;
+    denseIndex[index] = size();
+    liveBits[index >> 6] |= Uint64(1) << (index & 63);
+
+    x.push_back(posX);
+    y.push_back(posY);
+    prevX.push_back(posX);
+    prevY.push_back(posY);
+    vx.push_back(0.0f);
+    vy.push_back(0.0f);
+    animPhase.push_back(0.0f);
+    width.push_back(0);
+    height.push_back(0);
+    proxy.push_back(-1);
+    spawnId.push_back(-1);
+    chunk.push_back(-1);
+    homeChunk.push_back(-1);
+    value.push_back(0);
+    spawnTime.push_back(0);
+    sleptAt.push_back(0.0f);
+    handles.push_back(handle);
+
+    // Masuk range aktif: tukar dengan entity tidur pertama
+    if (denseIndex[index] != awake) swapEntities(denseIndex[index], awake);
+    awake++;
+    return handle;
+}
+
+void EntityStore::destroy(EntityHandle handle) {
+    int dense = indexOf(handle);
+    if (dense < 0) return;
+
+    // Entity aktif dipindah dulu ke awal range tidur, lalu entity
+    // terakhir mengisi lubang; array tetap rapat dan tetap terbagi dua
+    if (dense < awake) {
+        awake--;
+        if (dense != awake) swapEntities(dense, awake);
+        dense = awake;
+    }
+    int last = size() - 1;
+    if (dense != last) {
+        forEachColumn([dense, last](auto& column) { column[dense] = column[last]; });
+        denseIndex[handles[dense] & INDEX_MASK] = dense;
+    }
+    forEachColumn([](auto& column) { column.pop_back(); });
+
+    int index = handle & INDEX_MASK;
+    denseIndex[index] = -1;
+    generations[index] = static_cast<Uint16>((generations[index] + 1) & GENERATION_MASK);
+    liveBits[index >> 6] &= ~(Uint64(1) << (index & 63));
+    freeIndices.push_back(index);
+}
+
+void EntityStore::swapEntities(int a, int b) {
+    forEachColumn([a, b](auto& column) { std::swap(column[a], column[b]); });
+    denseIndex[handles[a] & INDEX_MASK] = a;
+    denseIndex[handles[b] & INDEX_MASK] = b;
+}
+
+void EntityStore::sleep(int index) {
+    if (index >= awake) return;
+    awake--;
+    if (index != awake) swapEntities(index, awake);
+}
+
+void EntityStore::wake(int index) {
+    if (index < awake || index >= size()) return;
+    if (index != awake) swapEntities(index, awake);
+    awake++;
+}
+
+bool EntityStore::alive(EntityHandle handle) const {
+    if (handle < 0) return false;
+    int index = handle & INDEX_MASK;
+    if (static_cast<size_t>(index) >= generations.size()) return false;
+    if (!(liveBits[index >> 6] & (Uint64(1) << (index & 63)))) return false;
+    return generations[index] == (handle >> INDEX_BITS);
+}
+
+int EntityStore::indexOf(EntityHandle handle) const {
+    return alive(handle) ? denseIndex[handle & INDEX_MASK] : -1;
+}
@@ -0,0 +1,131 @@
+#include "FileWatcher.h"
+#include <SDL2/SDL.h>
+#include <cerrno>
+#include <cstring>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#else
+#include <sys/stat.h>
+#endif
+
+static void splitPath(const std::string& path, std::string& directory, std::string& name) {
+    size_t slash = path.find_last_of("/\\");
+    if (slash == std::string::npos) {
+        directory = ".";
+        name = path;
+    } else {
+        directory = slash == 0 ? "/" : path.substr(0, slash);
+        name = path.substr(slash + 1);
+    }
+}
+
+#ifdef __linux__
+
+FileWatcher::FileWatcher() : fd(-1), wd(-1) {
+}
+
+FileWatcher::~FileWatcher() {
+    stop();
+}
+
+bool FileWatcher::watch(const std::string& filePath, std::string& error) {
+    stop();
+    path = filePath;
+
+    std::string directory;
+    splitPath(path, directory, fileName);
+
+    fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0) {
+        error = std::string("inotify_init1: ") + std::strerror(errno);
+        return false;
+    }
+
+    // Direktori yang di-watch, bukan file-nya: save lewat rename
+    // mengganti inode dan watch pada file lama akan hilang
+    wd = inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+    if (wd < 0) {
+        error = "cannot watch " + directory + ": " + std::strerror(errno);
+        stop();
+        return false;
+    }
+    return true;
+}
+
+void FileWatcher::stop() {
+    if (fd >= 0) close(fd);
+    fd = -1;
+    wd = -1;
+}
+
+bool FileWatcher::poll() {
+    if (fd < 0) return false;
+
+    bool changed = false;
+    alignas(inotify_event) char buffer[4096];
+
+    while (true) {
+        ssize_t length = read(fd, buffer, sizeof(buffer));
+        if (length <= 0) break;
+
+        for (ssize_t offset = 0; offset < length;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            if (event->len > 0 && fileName == event->name) changed = true;
+            offset += sizeof(inotify_event) + event->len;
+        }
+    }
+    return changed;
+}
+
+#else
+
+// Interval cek mtime untuk platform tanpa inotify (ms)
+static const Uint32 POLL_INTERVAL_MS = 250;
+
+static long long modifiedTime(const std::string& path) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) return -1;
+    return static_cast<long long>(st.st_mtime);
+}
+
+FileWatcher::FileWatcher() : lastModified(-1), lastCheck(0) {
+}
+
+FileWatcher::~FileWatcher() {
+    stop();
+}
+
+bool FileWatcher::watch(const std::string& filePath, std::string& error) {
+    path = filePath;
+    std::string directory;
+    splitPath(path, directory, fileName);
+
+    lastModified = modifiedTime(path);
+    lastCheck = SDL_GetTicks();
+    if (lastModified < 0) {
+        error = "cannot stat " + path;
+        return false;
+    }
+    return true;
+}
+
+void FileWatcher::stop() {
+    path.clear();
+}
+
+bool FileWatcher::poll() {
+    if (path.empty()) return false;
+
+    Uint32 now = SDL_GetTicks();
+    if (now - lastCheck < POLL_INTERVAL_MS) return false;
+    lastCheck = now;
+
+    long long modified = modifiedTime(path);
+    if (modified < 0 || modified == lastModified) return false;
+    lastModified = modified;
+    return true;
+}
+
+#endif
@@ -0,0 +1,23 @@
+#include "FlagSet.h"
+#include <algorithm>
+
+void FlagSet::clear() {
+    std::fill(words.begin(), words.end(), 0);
+    base = 0;
+}
+
+void FlagSet::reserve(int bits) {
+    if (bits <= base) return;
+    size_t needed = static_cast<size_t>((bits - base + 63) / 64);
+    if (needed <= words.size()) return;
+    words.resize(std::max(needed, words.size() * 2), 0);
+}
+
+void FlagSet::discardBelow(int index) {
+    if (index <= base + 63) return;
+    size_t drop = static_cast<size_t>((index - base) / 64);
+    drop = std::min(drop, words.size());
+    words.erase(words.begin(), words.begin() + drop);
+    base += static_cast<int>(drop) * 64;
+    if (words.empty()) base = index / 64 * 64;
+}
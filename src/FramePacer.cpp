@@ -0,0 +1,216 @@
+#include "FramePacer.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PACER_PAUSE() _mm_pause()
+#else
+#define PACER_PAUSE() std::this_thread::yield()
+#endif
+
+namespace {
+
+const size_t FRAME_HISTORY = 600;           // ~10 detik di 60 Hz
+const size_t CALIBRATION_FRAMES = 30;
+// Spin minimal selama ini sebelum deadline, walau SDL_Delay selalu tepat
+const double MIN_SPIN_MS = 0.5;
+
+// Interval present dianggap "di grid" kalau jaraknya ke kelipatan
+// refresh terdekat paling banyak fraksi periode ini
+const double GRID_TOLERANCE = 0.08;
+// Porsi interval kalibrasi yang harus di grid supaya vsync dianggap aktif
+const double GRID_FRACTION = 0.8;
+// Refresh rate yang umum. Kalau refresh tidak diketahui, hasil ukur
+// harus dekat salah satunya (frame cepat yang kebetulan stabil tanpa
+// vsync tidak ikut terhitung).
+const double REFRESH_RATES[] = {50.0, 59.94, 60.0, 72.0, 75.0, 85.0, 90.0, 100.0,
+                                120.0, 144.0, 165.0, 180.0, 240.0};
+
+// Jarak (ms) interval ke kelipatan refresh terdekat, minimal satu refresh
+double gridDeviation(double frameMs, double refreshMs) {
+    double multiple = std::max(1.0, std::floor(frameMs / refreshMs + 0.5));
+    return std::fabs(frameMs - multiple * refreshMs);
+}
+
+}
+
+FramePacer::FramePacer()
+    : frequency(SDL_GetPerformanceFrequency()), period(0), deadline(0), lastFrame(0),
+      capFps(0), displayHz(0), reportedHz(0), refreshMs(0.0), driftFrames(0),
+      vsync(VSYNC_OFF), sleepOvershootMs(1.0),
+      history(FRAME_HISTORY, 0.0f), historyNext(0), historyCount(0) {
+}
+
+void FramePacer::setTargetFps(int fps) {
+    capFps = fps > 0 ? fps : 0;
+    period = capFps > 0 ? frequency / capFps : 0;
+    deadline = 0;
+}
+
+void FramePacer::setVsync(bool vsyncRequested, int refreshRate) {
+    reportedHz = refreshRate > 0 ? refreshRate : 0;
+    if (vsyncRequested) {
+        startCalibration();
+    } else {
+        displayHz = reportedHz;
+        vsync = VSYNC_OFF;
+        deadline = 0;
+    }
+}
+
+void FramePacer::startCalibration() {
+    displayHz = reportedHz;
+    refreshMs = 0.0;
+    driftFrames = 0;
+    calibration.clear();
+    vsync = VSYNC_CALIBRATING;
+    deadline = 0;
+}
+
+bool FramePacer::pacing() const {
+    if (period == 0) return false;
+    if (vsync == VSYNC_CALIBRATING) return false;       // Ukur present apa adanya
+    if (vsync == VSYNC_ACTIVE) {
+        // Present sudah menahan di refresh rate; pacer hanya untuk batas di bawahnya
+        return displayHz == 0 || capFps * 10 < displayHz * 9;
+    }
+    return true;
+}
+
+void FramePacer::sleepUntil(Uint64 target) {
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (now >= target) return;
+
+    // Sleep kasar: sisakan margin untuk telat bangun + spin minimal
+    double remainingMs = (target - now) * 1000.0 / frequency;
+    double sleepMs = remainingMs - sleepOvershootMs - MIN_SPIN_MS;
+    if (sleepMs >= 1.0) {
+        Uint32 requested = static_cast<Uint32>(sleepMs);
+        Uint64 before = SDL_GetPerformanceCounter();
+        SDL_Delay(requested);
+        double actualMs = (SDL_GetPerformanceCounter() - before) * 1000.0 / frequency;
+
+        // Rata-rata bergerak telat bangun, naik cepat turun pelan
+        double overshoot = std::max(0.0, actualMs - requested);
+        double weight = overshoot > sleepOvershootMs ? 0.5 : 0.05;
+        sleepOvershootMs += (overshoot - sleepOvershootMs) * weight;
+    }
+
+    // Spin sisa waktu
+    while (SDL_GetPerformanceCounter() < target) PACER_PAUSE();
+}
+
+void FramePacer::wait() {
+    if (pacing()) {
+        Uint64 now = SDL_GetPerformanceCounter();
+        // Frame pertama, atau tertinggal lebih dari satu frame: jadwal
+        // mulai dari sekarang (tidak mengejar dengan frame beruntun)
+        if (deadline == 0 || now > deadline + period) deadline = now;
+        deadline += period;
+        sleepUntil(deadline);
+    }
+
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (lastFrame != 0) {
+        double frameMs = (now - lastFrame) * 1000.0 / frequency;
+        record(frameMs);
+
+        if (vsync == VSYNC_CALIBRATING) {
+            calibration.push_back(frameMs);
+            if (calibration.size() >= CALIBRATION_FRAMES) finishCalibration();
+        } else if (vsync == VSYNC_ACTIVE) {
+            checkDrift(frameMs);
+        }
+    }
+    lastFrame = now;
+}
+
+void FramePacer::idle() {
+    lastFrame = 0;
+    deadline = 0;
+}
+
+bool FramePacer::onRefreshGrid(double periodMs) const {
+    double tolerance = periodMs * GRID_TOLERANCE;
+    size_t hits = 0;
+    double squared = 0.0;
+    for (double ms : calibration) {
+        double deviation = gridDeviation(ms, periodMs);
+        if (deviation > tolerance) continue;
+        hits++;
+        squared += deviation * deviation;
+    }
+    if (hits == 0 || hits < calibration.size() * GRID_FRACTION) return false;
+
+    // Yang di grid juga harus rapat, bukan sekadar kebetulan masuk toleransi
+    return std::sqrt(squared / hits) <= tolerance * 0.5;
+}
+
+void FramePacer::finishCalibration() {
+    // Vsync aktif kalau interval present mengumpul di kelipatan satu
+    // periode refresh dengan variansi kecil
+    double periodMs = 0.0;
+    if (displayHz > 0 && onRefreshGrid(1000.0 / displayHz)) {
+        periodMs = 1000.0 / displayHz;
+    } else {
+        // Refresh tidak diketahui (atau yang dilaporkan salah): median
+        // jadi kandidat periode, asal dekat refresh rate yang umum
+        std::vector<double> sorted = calibration;
+        std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+        double medianHz = 1000.0 / sorted[sorted.size() / 2];
+        for (double rate : REFRESH_RATES) {
+            if (std::fabs(medianHz - rate) <= rate * 0.02 && onRefreshGrid(1000.0 / rate)) {
+                periodMs = 1000.0 / rate;
+                break;
+            }
+        }
+    }
+
+    vsync = periodMs > 0.0 ? VSYNC_ACTIVE : VSYNC_OFF;
+    if (vsync == VSYNC_ACTIVE) displayHz = static_cast<int>(std::lround(1000.0 / periodMs));
+    refreshMs = periodMs;
+    driftFrames = 0;
+    calibration.clear();
+    deadline = 0;
+}
+
+void FramePacer::checkDrift(double frameMs) {
+    // Interval yang keluar dari grid refresh (vsync dimatikan driver,
+    // window pindah ke monitor lain). Hitungan turun lagi untuk tiap
+    // interval yang kembali di grid, jadi hitch sesaat tidak memicu apa-apa.
+    if (gridDeviation(frameMs, refreshMs) > refreshMs * GRID_TOLERANCE) {
+        driftFrames++;
+    } else if (driftFrames > 0) {
+        driftFrames--;
+    }
+    if (driftFrames >= static_cast<int>(CALIBRATION_FRAMES)) startCalibration();
+}
+
+void FramePacer::record(double frameMs) {
+    history[historyNext] = static_cast<float>(frameMs);
+    historyNext = (historyNext + 1) % history.size();
+    if (historyCount < history.size()) historyCount++;
+}
+
+FrameTimeStats FramePacer::stats() const {
+    FrameTimeStats result = {0, 0.0, 0.0, 0.0, 0.0};
+    if (historyCount == 0) return result;
+
+    std::vector<float> samples(history.begin(), history.begin() + historyCount);
+    double sum = 0.0;
+    for (float ms : samples) sum += ms;
+    result.frames = static_cast<int>(historyCount);
+    result.meanMs = sum / historyCount;
+
+    double variance = 0.0;
+    for (float ms : samples) variance += (ms - result.meanMs) * (ms - result.meanMs);
+    result.stddevMs = std::sqrt(variance / historyCount);
+
+    size_t p99 = std::min(samples.size() - 1, samples.size() * 99 / 100);
+    std::nth_element(samples.begin(), samples.begin() + p99, samples.end());
+    result.p99Ms = samples[p99];
+    result.maxMs = *std::max_element(samples.begin(), samples.end());
+    return result;
+}
@@ -1,10 +1,30 @@
 #include "GameBox.h"
+#include "GameScene.h"
+#include "World.h"
+#include "ChunkSource.h"
+#include "LevelGenerator.h"
+#include "EditableLevel.h"
+#include "FileWatcher.h"
+#include "Broadphase.h"
+#include "EntityStore.h"
+#include "EmbeddedLevel.h"
+#include "LevelFile.h"
+#include "StageManager.h"
+#include "ChunkTextureCache.h"
+#include "RenderQueue.h"
+#include "GlyphAtlas.h"
+#include "HudLayer.h"
+#include "SpriteSheet.h"
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
 
 // Game constants
 const float GRAVITY = 1200.0f;
@@ -16,27 +36,83 @@ const int TILE_SIZE = 32;
 // Camera offset - jarak player dari tepi kiri layar
 const int CAMERA_OFFSET_X = 200;
 
-void renderText(SDL_Renderer* renderer, TTF_Font* font, const char* text, int x, int y, SDL_Color color, bool centered) {
-    if (!font) return;
-    
-    SDL_Surface* surface = TTF_RenderText_Solid(font, text, color);
-    if (surface) {
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-        SDL_Rect rect = {
-            centered ? x - surface->w / 2 : x,
-            y - surface->h / 2,
-            surface->w,
-            surface->h
-        };
-        SDL_RenderCopy(renderer, texture, nullptr, &rect);
-        SDL_DestroyTexture(texture);
-        SDL_FreeSurface(surface);
-    }
+// Simulasi fixed timestep: hasil physics tidak tergantung frame rate
+const int SIM_RATE = 120;
+const float SIM_TICK = 1.0f / SIM_RATE;
+// Thread simulasi yang tertinggal tidak mengejar lebih dari ini (hindari spiral)
+const int MAX_TICKS_PER_FRAME = 12;
+
+// Floating text yang tampil bersamaan; kalau penuh, yang tertua didaur ulang
+const int MAX_FLOATING_TEXTS = 32;
+
+// Bit input gerak, di-sample thread SDL untuk thread simulasi
+const int INPUT_LEFT = 1;
+const int INPUT_RIGHT = 2;
+
+// Level hasil compile levelc (lihat levels/*.txt): levels/<nama stage>.lvl
+const char* LEVEL_DIR = "levels/";
+
+// Tinggi level endless (sama dengan mainLevel)
+const int ENDLESS_ROWS = 20;
+
+// Mode endless dan hot reload (diatur dari command line, lihat main.cpp)
+bool endlessMode = false;
+Uint32 endlessSeed = 0;
+std::string watchLevelPath;
+CanvasScale canvasScale = CANVAS_FIT;
+int activationMargin = StreamingConfig().activeMarginPixels;
+
+// Stage yang sedang dimainkan (index ke daftar stage, lihat GameScene::init).
+// Restart setelah game over mengulang stage ini.
+int currentStage = 0;
+
+// Box broadphase untuk floating text (coin dan enemy diurus World)
+static SDL_Rect floatingTextBox(float x, float y) {
+    SDL_Rect r = {static_cast<int>(x) - 24, static_cast<int>(y) - 8, 48, 16};
+    return r;
+}
+
+// Posisi render di antara tick sebelumnya dan tick sekarang
+static float interpolate(float previous, float current, float alpha) {
+    return previous + (current - previous) * alpha;
+}
+
+// Layer render (lihat RenderQueue.h). Item yang saling menimpa harus
+// beda layer; di dalam satu layer urutan gambar tidak dijamin.
+enum GameLayer {
+    LAYER_BACKGROUND,
+    LAYER_SKY,
+    LAYER_TILES,            // drawChunkTiles memakai layer ini dan layer + 1
+    LAYER_TILES_DETAIL,
+    LAYER_GROUND,
+    LAYER_COIN,
+    LAYER_ENEMY,
+    LAYER_PLAYER,
+    LAYER_FLOATING_TEXT,
+    LAYER_HUD,
+    LAYER_HUD_DETAIL,
+    LAYER_OVERLAY,
+    LAYER_DIALOG,
+    LAYER_DIALOG_DETAIL
+};
+
+const SDL_Color COLOR_WHITE = {255, 255, 255, 255};
+
+void renderText(RenderQueue& queue, int layer, GlyphAtlas& atlas, const char* text, int x, int y, SDL_Color color, bool centered) {
+    if (!atlas.valid()) return;
+    
+    // Quad dari atlas glyph, tanpa surface/texture per frame
+    atlas.draw(queue, layer, text, x, y - atlas.lineHeight() / 2, color, centered);
 }
 
 // ========================================
 // LEVEL DESIGN - BUAT LEVEL ANDA DI SINI!
 // ========================================
+// Level built-in, dipakai kalau levels/1-1.lvl tidak ditemukan.
+// Di-parse saat compile (lihat EmbeddedLevel.h): level yang rusak
+// membuat build gagal, dan memulai level tidak perlu parsing sama sekali.
+// Untuk level baru, buat file di levels/ - akan di-compile oleh levelc.
+//
 // Legend:
 // ' ' = empty space
 // 'G' = ground/grass block
@@ -52,7 +128,7 @@ void renderText(SDL_Renderer* renderer, TTF_Font* font, const char* text, int x,
 // - Level bisa sepanjang yang Anda mau (horizontal)
 // - Player spawn di 'P'
 
-std::vector<std::string> mainLevel = {
+constexpr std::string_view mainLevel[] = {
       "                                                                                                                                                                          ",  // Baris 0
       "                                                                                                                                                                          ",  // Baris 1
       "                                                                                                                                                                          ",  // Baris 2
@@ -75,103 +151,95 @@ std::vector<std::string> mainLevel = {
       "  P            E              e                 E           e                   E               e                       E                   e                           ",  // Baris 19 - Ground level
 };
 
-// Function to parse level from string array
-void parseLevelFromArray(const std::vector<std::string>& levelData, 
-                        std::vector<Platform>& platforms,
-                        std::vector<Coin>& coins,
-                        std::vector<Enemy>& enemies,
-                        float& playerStartX, float& playerStartY,
-                        int windowWidth, int windowHeight) {
-    
-    // Clear existing data
-    platforms.clear();
-    coins.clear();
-    enemies.clear();
-    
-    // Calculate level dimensions
-    int levelHeight = levelData.size();
-    int levelWidth = 0;
-    for (const auto& row : levelData) {
-        if (row.length() > levelWidth) levelWidth = row.length();
-    }
+// Stage 1-2 (sama dengan levels/1-2.txt)
+constexpr std::string_view stage2Level[] = {
+      "                                                                                                                                                                                    ",  // Baris 0
+      "                                                                                                                                                                                    ",  // Baris 1
+      "                                                                                                                                                                                    ",  // Baris 2
+      "                                                                                                                                                                                    ",  // Baris 3
+      "                                                                                                                                                                                    ",  // Baris 4
+      "                                                                                                                                                                                    ",  // Baris 5
+      "                                                                                                                                                                                    ",  // Baris 6
+      "                                                                                                                                                                                    ",  // Baris 7
+      "                                                                                                                                                                                    ",  // Baris 8
+      "                                                                                                                                                                                    ",  // Baris 9
+      "                                                                                                                                                                                    ",  // Baris 10
+      "                                                                                                                                                                                    ",  // Baris 11
+      "                                                        C                                                                                                                           ",  // Baris 12
+      "                                                                         C C                                                                                                        ",  // Baris 13
+      "                          ?   ?                       B?B?B             BBBB                    ?   ?   ?                                             C   C   C                     ",  // Baris 14
+      "              C C C                                                   BB                                                    BB?BB                                                   ",  // Baris 15
+      "              BBBBB                         C                       BB              CCCC                       C  C                       CCCC                                      ",  // Baris 16
+      "        BBB                       BBBB    BBBBB                   BB                BBBB                      BBBBBB                    BBBBBBBB                                    ",  // Baris 17
+      "                                                                                                                                                                                    ",  // Baris 18
+      "  P               E            e               E            e  E              e             E           e            E            e              E            e                     ",  // Baris 19 - Ground level
+};
+
+using MainLevel = EmbeddedLevelData<mainLevel, TILE_SIZE>;
+using Stage2Level = EmbeddedLevelData<stage2Level, TILE_SIZE>;
+
+// ========================================
+// GameScene
+// ========================================
+
+GameScene::GameScene()
+    : renderer(nullptr), windowWidth(0), windowHeight(0), loaded(false),
+      gameFont(nullptr), smallFont(nullptr), showRenderStats(false),
+      simPaused(true), simStop(false), moveInput(0), simWidth(0), simHeight(0),
+      playerX(0.0f), playerY(0.0f), playerStartX(100.0f), playerStartY(100.0f),
+      velocityX(0.0f), velocityY(0.0f), isOnGround(false), facingRight(true),
+      cameraX(0.0f), prevPlayerX(0.0f), prevPlayerY(0.0f), prevCameraX(0.0f),
+      score(0), lives(3), gameOver(false), levelComplete(false), deathTime(0), animPhase(0.0f),
+      textOrder(MAX_FLOATING_TEXTS, NO_ENTITY), textOrderHead(0), textOrderCount(0),
+      simTicks(0),
+      world(nullptr), stageMode(false), levelWidthPixels(-1), editableLevel(nullptr),
+      broadphase(nullptr), playerProxy(-1) {
+    // Semua slot floating text dialokasikan sekali di sini
+    floatingTexts.reserve(MAX_FLOATING_TEXTS);
+}
+
+GameScene::~GameScene() {
+    cleanup();
+}
+
+void GameScene::closeFonts() {
+    gameText.release();
+    smallText.release();
+    if (gameFont) TTF_CloseFont(gameFont);
+    if (smallFont) TTF_CloseFont(smallFont);
+    gameFont = nullptr;
+    smallFont = nullptr;
+}
+
+void GameScene::cleanup() {
+    // Thread simulasi berhenti dulu sebelum state yang dipakainya dilepas.
+    // Texture dilepas sebelum renderer, World sebelum source-nya
+    stopSimulation();
+    loaded = false;
     
-    // Ground level
-    int groundY = windowHeight - 80;
+    tileLayer.reset();
+    hud.reset();
+    sprites.release();
+    closeFonts();
     
-    // Parse from top to bottom
-    for (int row = 0; row < levelHeight; row++) {
-        const std::string& line = levelData[row];
-        
-        for (int col = 0; col < line.length(); col++) {
-            char tile = line[col];
-            int x = col * TILE_SIZE;
-            int y = row * TILE_SIZE;
-            
-            switch (tile) {
-                case 'G':  // Ground / Grass
-                    platforms.push_back({{x, y, TILE_SIZE, TILE_SIZE}, false, true, false});
-                    break;
-                    
-                case 'B':  // Brick platform
-                    platforms.push_back({{x, y, TILE_SIZE, TILE_SIZE}, false, true, false});
-                    break;
-                    
-                case '?':  // Question block (coin block)
-                    platforms.push_back({{x, y, TILE_SIZE, TILE_SIZE}, true, false, false});
-                    break;
-                    
-                case 'C':  // Coin
-                    coins.push_back({x + TILE_SIZE/2, y + TILE_SIZE/2, false, 0.0f});
-                    break;
-                    
-                case 'E':  // Enemy (moving right)
-                    {
-                        Enemy e;
-                        e.x = static_cast<float>(x);
-                        e.y = static_cast<float>(y);
-                        e.vx = 50.0f;  // Moving right
-                        e.rect = {x, y, 28, 28};
-                        e.active = true;
-                        enemies.push_back(e);
-                    }
-                    break;
-                    
-                case 'e':  // Enemy (moving left)
-                    {
-                        Enemy e;
-                        e.x = static_cast<float>(x);
-                        e.y = static_cast<float>(y);
-                        e.vx = -50.0f;  // Moving left
-                        e.rect = {x, y, 28, 28};
-                        e.active = true;
-                        enemies.push_back(e);
-                    }
-                    break;
-                    
-                case 'P':  // Player start position
-                    playerStartX = static_cast<float>(x);
-                    playerStartY = static_cast<float>(y);
-                    break;
-                    
-                case ' ':  // Empty space
-                default:
-                    break;
-            }
-        }
-    }
-    
-    // Add full ground at bottom
-    int levelWidthPixels = levelWidth * TILE_SIZE;
-    for (int x = 0; x < levelWidthPixels; x += TILE_SIZE) {
-        platforms.push_back({{x, groundY, TILE_SIZE, 80}, false, true, false});
-    }
+    world = nullptr;
+    broadphase = nullptr;
+    ownWorld.clear();
+    editableLevel = nullptr;
+    levelSource.reset();
+    clearFloatingTexts();
 }
 
-bool runGameBox(SDL_Renderer* renderer)
+bool GameScene::init(SDL_Renderer* r, int viewWidth, int viewHeight)
 {
+    cleanup();
+    renderer = r;
+    windowWidth = viewWidth;
+    windowHeight = viewHeight;
+    simWidth = viewWidth;
+    simHeight = viewHeight;
+    
     // Load font for UI
-    TTF_Font* gameFont = nullptr;
-    TTF_Font* smallFont = nullptr;
     const char* font_paths[] = {
           "assets/PressStart2P-Regular.ttf  ",
           "/usr/share/fonts/truetype/dejavu/DejaVuSans-Bold.ttf  ",
@@ -184,309 +252,653 @@ bool runGameBox(SDL_Renderer* renderer)
         if (gameFont && smallFont) break;
     }
     
-    // Get window size
-    int windowWidth, windowHeight;
-    SDL_GetRendererOutputSize(renderer, &windowWidth, &windowHeight);
-    
-    // Player state
-    float playerX = 100.0f;
-    float playerY = 100.0f;
-    float playerStartX = 100.0f;
-    float playerStartY = 100.0f;
-    float velocityX = 0.0f;
-    float velocityY = 0.0f;
-    bool isOnGround = false;
-    bool facingRight = true;
-    
-    // Camera position (world coordinate)
-    float cameraX = 0.0f;
-    
-    // Calculate level width
-    int levelWidth = 0;
-    for (const auto& row : mainLevel) {
-        if (row.length() > levelWidth) levelWidth = row.length();
+    // Atlas glyph per font, dibangun saat teks pertama digambar
+    gameText.init(gameFont);
+    smallText.init(smallFont);
+    
+    // ===== LEVEL =====
+    // Level .lvl di-mmap dan dipakai langsung; kalau tidak ada,
+    // dipakai tabel built-in yang sudah di-parse saat compile
+    Uint64 loadStart = SDL_GetPerformanceCounter();
+    std::string levelError;
+    stageMode = false;
+    streaming.activeMarginPixels = std::max(0, activationMargin);
+    
+    if (endlessMode) {
+        // Level endless di-generate di worker thread; hanya section yang
+        // langsung terlihat yang ditunggu di sini, sisanya di-stream
+        GeneratedChunkSource* generator = new GeneratedChunkSource(endlessSeed, ENDLESS_ROWS, TILE_SIZE);
+        levelSource.reset(generator);
+        for (int i = 0; i * streaming.chunkCols * TILE_SIZE < windowWidth; i++) {
+            generator->waitForChunk(i, streaming.chunkCols);
+        }
+    } else if (!watchLevelPath.empty()) {
+        editableLevel = new EditableLevelSource(TILE_SIZE);
+        levelSource.reset(editableLevel);
+        if (!editableLevel->load(watchLevelPath, levelError)) {
+            std::cerr <<   watchLevelPath << ": " << levelError << std::endl;
+            cleanup();
+            return false;
+        }
+        if (!levelWatcher.watch(watchLevelPath, levelError)) {
+            std::cout <<   "[!] " << levelError <<   " - hot reload disabled" << std::endl;
+        }
+    } else {
+        stageMode = true;
+        if (stages.stageCount() == 0) {
+#ifdef GAMW_EMBEDDED_LEVELS
+            // Build kiosk: hanya level di dalam binary
+            stages.addStage("1-1", "", MainLevel::level.view());
+            stages.addStage("1-2", "", Stage2Level::level.view());
+#else
+            stages.addStage("1-1", std::string(LEVEL_DIR) + "1-1.lvl", MainLevel::level.view());
+            stages.addStage("1-2", std::string(LEVEL_DIR) + "1-2.lvl", Stage2Level::level.view());
+#endif
+        }
+        if (currentStage < 0 || currentStage >= stages.stageCount()) currentStage = 0;
+        
+        // Stage pertama disiapkan di sini, stage berikutnya langsung di-preload
+        if (!stages.start(currentStage, windowWidth, streaming, levelError)) {
+            std::cerr <<   "[!] " << levelError << std::endl;
+            cleanup();
+            return false;
+        }
     }
-    int levelWidthPixels = levelWidth * TILE_SIZE;
     
-    // Game state
-    int score = 0;
-    int lives = 3;
-    bool gameOver = false;
-    bool levelComplete = false;
-    Uint32 deathTime = 0;
+    // Geometry statis digambar sekali per chunk ke texture
+    tileLayer.reset(new ChunkTextureCache(renderer));
     
-    // Animation
-    float animPhase = 0.0f;
+    // HUD dan panel akhir di-cache sebagai texture
+    hud.reset(new HudLayer(renderer));
+    hud->init(&gameText, &smallText);
     
-    // Floating texts
-    std::vector<FloatingText> floatingTexts;
+    // Player, enemy dan coin dari satu atlas sprite
+    sprites.init(renderer);
     
-    // Game objects
-    std::vector<Platform> platforms;
-    std::vector<Coin> coins;
-    std::vector<Enemy> enemies;
+    // Snapshot pertama dipublish sebelum thread simulasi jalan, jadi
+    // render selalu punya sesuatu untuk digambar
+    simTicks = 0;
+    restart();
+    publishSnapshot();
     
-    // Parse level from array
-    parseLevelFromArray(mainLevel, platforms, coins, enemies, 
-                       playerStartX, playerStartY, windowWidth, windowHeight);
+    double loadMs = (SDL_GetPerformanceCounter() - loadStart) * 1000.0 / SDL_GetPerformanceFrequency();
+    
+    std::cout <<   "=== Cat Mario Style Game Started ===  " << std::endl;
+    if (endlessMode) {
+        std::cout <<   "Endless level, seed:   " << endlessSeed << std::endl;
+    } else if (editableLevel) {
+        std::cout <<   "Watching level:   " << watchLevelPath <<   " (" << editableLevel->cols() << "x" << editableLevel->rows()
+                  <<   " tiles, " << editableLevel->spawnCount() <<   " spawns)  " << std::endl;
+    } else {
+        printStageInfo();
+    }
+    std::cout <<   "Level load time:   " << loadMs <<   " ms  " << std::endl;
+    std::cout <<   "Controls: A/D = Move, Space/W = Jump  " << std::endl;
+    
+    // Mulai dalam keadaan pause; Game melepasnya lewat setPaused
+    loaded = true;
+    startSimulation();
+    return true;
+}
+
+void GameScene::restart() {
+    // World dibangun ulang dari source yang sudah dimuat: block, coin,
+    // dan enemy kembali ke awal tanpa membaca level lagi
+    ChunkSource* source = stageMode ? stages.current().source.get() : levelSource.get();
+    world = stageMode ? &stages.current().world : &ownWorld;
+    world->load(source, streaming);
+    world->stream(0.0f, simWidth);
+    
+    score = 0;
+    lives = 3;
+    gameOver = false;
+    levelComplete = false;
+    deathTime = 0;
+    animPhase = 0.0f;
+    placePlayer();
+}
+
+void GameScene::placePlayer() {
+    broadphase = &world->broadphase();
+    world->playerStart(playerStartX, playerStartY);
+    levelWidthPixels = world->widthPixels();
     
-    // Set player to start position
     playerX = playerStartX;
     playerY = playerStartY;
+    velocityX = 0.0f;
+    velocityY = 0.0f;
+    isOnGround = false;
+    cameraX = 0.0f;
+    snapInterpolation();
+    
+    // Proxy lama ikut broadphase stage sebelumnya (atau sudah dibersihkan World::load)
+    clearFloatingTexts();
+    SDL_Rect box = {static_cast<int>(playerX), static_cast<int>(playerY), PLAYER_SIZE, PLAYER_SIZE};
+    playerProxy = broadphase->add(box, BP_PLAYER, 0);
+}
+
+// Spawn helpers - entity baru langsung didaftarkan ke broadphase
+void GameScene::spawnFloatingText(float x, float y, float vy, int value, Uint32 time) {
+    // Umur semua text sama, jadi urutan spawn = urutan habis: handle di
+    // kepala textOrder yang sudah habis dibuang, lalu kalau pool masih
+    // penuh, kepala (yang tertua) didaur ulang
+    while (textOrderCount > 0 && !floatingTexts.alive(textOrder[textOrderHead])) {
+        textOrderHead = (textOrderHead + 1) % MAX_FLOATING_TEXTS;
+        textOrderCount--;
+    }
+    if (floatingTexts.full() || textOrderCount == MAX_FLOATING_TEXTS) {
+        EntityHandle oldest = textOrder[textOrderHead];
+        int index = floatingTexts.indexOf(oldest);
+        if (index >= 0) {
+            broadphase->remove(floatingTexts.proxy[index]);
+            floatingTexts.destroy(oldest);
+        }
+        textOrderHead = (textOrderHead + 1) % MAX_FLOATING_TEXTS;
+        textOrderCount--;
+    }
     
-    SDL_Event event;
-    bool running = true;
-    Uint32 lastTime = SDL_GetTicks();
+    EntityHandle handle = floatingTexts.create(x, y);
+    textOrder[(textOrderHead + textOrderCount) % MAX_FLOATING_TEXTS] = handle;
+    textOrderCount++;
     
-    std::cout <<   "=== Cat Mario Style Game Started ===  " << std::endl;
-    std::cout <<   "Level loaded:   " << platforms.size() <<   " platforms,   "
-              << coins.size() <<   " coins,   "
-              << enemies.size() <<   " enemies  " << std::endl;
-    std::cout <<   "Level width:   " << levelWidthPixels <<   " pixels  " << std::endl;
-    std::cout <<   "Controls: A/D = Move, Space/W = Jump  " << std::endl;
+    int i = floatingTexts.indexOf(handle);
+    floatingTexts.vy[i] = vy;
+    floatingTexts.value[i] = value;
+    floatingTexts.spawnTime[i] = time;
+    floatingTexts.proxy[i] = broadphase->add(floatingTextBox(x, y), BP_TEXT, handle);
+}
+
+// Proxy tidak dilepas: broadphase-nya ikut di-clear / ditukar pemanggil
+void GameScene::clearFloatingTexts() {
+    floatingTexts.clear();
+    textOrderHead = 0;
+    textOrderCount = 0;
+}
+
+// Teleport (respawn, stage baru) tidak diinterpolasi dari posisi lama
+void GameScene::snapInterpolation() {
+    prevPlayerX = playerX;
+    prevPlayerY = playerY;
+    prevCameraX = cameraX;
+}
+
+void GameScene::printStageInfo() {
+    PreparedStage& stage = stages.current();
+    const TileMap& tiles = stage.source->tiles();
+    std::cout <<   "Stage   " << stages.stage(stage.index).name <<   ":   " << tiles.cols() << "x" << tiles.rows() <<   " tiles, " 
+              << tiles.colliderCount() <<   " colliders (from " << tiles.solidCount() <<   " solid tiles),   "
+              << stage.level.coinCount() <<   " coins,   "
+              << stage.level.enemyCount() <<   " enemies  " << std::endl;
+    std::cout <<   "Level width:   " << levelWidthPixels <<   " pixels, prepared in   " << stage.prepareMs <<   " ms  " << std::endl;
+}
+
+// Pindah ke stage yang sudah di-preload: World, source, dan broadphase
+// ditukar; font, skor, dan nyawa tetap
+bool GameScene::enterNextStage() {
+    Uint64 swapStart = SDL_GetPerformanceCounter();
+    std::string levelError;
+    if (!stages.advance(levelError)) {
+        std::cout <<   "[!] Next stage unavailable:   " << levelError << std::endl;
+        return false;
+    }
+    currentStage = stages.currentIndex();
     
-    while (running)
+    world = &stages.current().world;
+    placePlayer();
+    
+    double swapMs = (SDL_GetPerformanceCounter() - swapStart) * 1000.0 / SDL_GetPerformanceFrequency();
+    printStageInfo();
+    std::cout <<   "Stage switch:   " << swapMs <<   " ms  " << std::endl;
+    return true;
+}
+
+void GameScene::resize(int viewWidth, int viewHeight) {
+    windowWidth = viewWidth;
+    windowHeight = viewHeight;
+    if (hud) hud->invalidate();
+    if (loaded) pushCommand(COMMAND_RESIZE, viewWidth, viewHeight);
+}
+
+void GameScene::invalidateCache() {
+    if (tileLayer) tileLayer->invalidate();
+    if (hud) hud->invalidate();
+}
+
+void GameScene::handleEvent(const SDL_Event& e) {
+    if (e.type != SDL_KEYDOWN || !ready()) return;
+    
+    // Aksi gameplay dikirim ke thread simulasi, dijalankan tick berikutnya
+    switch (e.key.keysym.sym)
     {
-        // Calculate delta time
-        Uint32 currentTime = SDL_GetTicks();
-        float deltaTime = (currentTime - lastTime) / 1000.0f;
-        lastTime = currentTime;
-        
-        if (deltaTime > 0.05f) deltaTime = 0.05f;
-        
-        // ------- EVENTS -------
-        while (SDL_PollEvent(&event))
+    case SDLK_SPACE:
+    case SDLK_UP:
+    case SDLK_w:
+        pushCommand(COMMAND_JUMP);
+        break;
+    case SDLK_F3:
+        showRenderStats = !showRenderStats;
+        break;
+    case SDLK_r:
+        pushCommand(COMMAND_RESTART);
+        break;
+    }
+}
+
+void GameScene::update() {
+    if (!ready()) return;
+    
+    // SDL_GetKeyboardState hanya aman di thread yang memproses event
+    const Uint8* keystate = SDL_GetKeyboardState(NULL);
+    int input = 0;
+    if (keystate[SDL_SCANCODE_LEFT] || keystate[SDL_SCANCODE_A]) input |= INPUT_LEFT;
+    if (keystate[SDL_SCANCODE_RIGHT] || keystate[SDL_SCANCODE_D]) input |= INPUT_RIGHT;
+    moveInput.store(input, std::memory_order_relaxed);
+}
+
+void GameScene::setPaused(bool paused) {
+    std::lock_guard<std::mutex> lock(simMutex);
+    if (simPaused == paused) return;
+    simPaused = paused;
+    simWake.notify_one();
+}
+
+void GameScene::pushCommand(CommandType type, int width, int height) {
+    Command command = {type, width, height};
+    std::lock_guard<std::mutex> lock(simMutex);
+    commands.push_back(command);
+    simWake.notify_one();
+}
+
+// ========================================
+// Thread simulasi
+// ========================================
+
+void GameScene::startSimulation() {
+    simStop = false;
+    simThread = std::thread(&GameScene::simulationLoop, this);
+}
+
+void GameScene::stopSimulation() {
+    if (!simThread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(simMutex);
+        simStop = true;
+        simWake.notify_one();
+    }
+    simThread.join();
+    commands.clear();
+}
+
+void GameScene::applyCommands() {
+    for (const Command& command : pendingCommands) {
+        switch (command.type) {
+        case COMMAND_JUMP:
+            if (isOnGround && !gameOver && !levelComplete) {
+                velocityY = JUMP_FORCE;
+                isOnGround = false;
+            }
+            break;
+        case COMMAND_RESTART:
+            if (gameOver) {
+                restart();
+            }
+            break;
+        case COMMAND_RESIZE:
+            simWidth = command.width;
+            simHeight = command.height;
+            world->stream(cameraX, simWidth);
+            break;
+        }
+    }
+    pendingCommands.clear();
+}
+
+void GameScene::simulationLoop() {
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    const Uint64 period = frequency / SIM_RATE;
+    Uint64 nextTick = 0;        // 0 = jadwal mulai dari sekarang
+    
+    for (;;) {
+        bool paused;
         {
-            if (event.type == SDL_QUIT)
-                return false;
-                
-            if (event.type == SDL_KEYDOWN)
-            {
-                switch (event.key.keysym.sym)
-                {
-                case SDLK_ESCAPE:
-                    return false;
-                case SDLK_SPACE:
-                case SDLK_UP:
-                case SDLK_w:
-                    if (isOnGround && !gameOver && !levelComplete) {
-                        velocityY = JUMP_FORCE;
-                        isOnGround = false;
-                    }
-                    break;
-                case SDLK_r:
-                    if (gameOver) {
-                        return true;  // Restart
-                    }
-                    break;
-                }
+            std::unique_lock<std::mutex> lock(simMutex);
+            if (simPaused && !simStop && commands.empty()) {
+                simWake.wait(lock, [this] { return simStop || !simPaused || !commands.empty(); });
+                nextTick = 0;   // Waktu selama pause tidak dikejar
             }
+            if (simStop) return;
+            pendingCommands.swap(commands);
+            paused = simPaused;
+        }
+        
+        if (!pendingCommands.empty()) {
+            applyCommands();
+            // Selama pause (mis. resize dari menu) snapshot tetap diperbarui
+            if (paused) publishSnapshot();
+        }
+        if (paused) continue;
+        
+        // Tick di jadwal absolut SIM_RATE. Tertinggal terlalu jauh
+        // (thread tertahan lama): jadwal mulai dari sekarang
+        Uint64 now = SDL_GetPerformanceCounter();
+        if (nextTick == 0 || now > nextTick + MAX_TICKS_PER_FRAME * period) nextTick = now;
+        if (now < nextTick) {
+            std::unique_lock<std::mutex> lock(simMutex);
+            std::chrono::microseconds wait((nextTick - now) * 1000000 / frequency);
+            simWake.wait_for(lock, wait, [this] { return simStop || simPaused; });
+            continue;
         }
+        nextTick += period;
+        simTicks++;
         
-        if (!gameOver && !levelComplete) {
-            // ------- INPUT -------
-            const Uint8* keystate = SDL_GetKeyboardState(NULL);
-            velocityX = 0.0f;
+        // ------- HOT RELOAD -------
+        // Hanya cell yang berubah yang di-patch; player dan kamera tetap
+        if (editableLevel && levelWatcher.poll()) {
+            Uint64 reloadStart = SDL_GetPerformanceCounter();
+            int dirtyX0, dirtyX1, changedCells;
+            std::string levelError;
             
-            if (keystate[SDL_SCANCODE_LEFT] || keystate[SDL_SCANCODE_A]) {
-                velocityX = -MOVE_SPEED;
-                facingRight = false;
-            }
-            if (keystate[SDL_SCANCODE_RIGHT] || keystate[SDL_SCANCODE_D]) {
-                velocityX = MOVE_SPEED;
-                facingRight = true;
+            if (editableLevel->reload(dirtyX0, dirtyX1, changedCells, levelError)) {
+                world->refreshRange(dirtyX0, dirtyX1);
+                world->playerStart(playerStartX, playerStartY);
+                levelWidthPixels = world->widthPixels();
+                world->stream(cameraX, simWidth);
+                
+                double reloadMs = (SDL_GetPerformanceCounter() - reloadStart) * 1000.0 / frequency;
+                std::cout <<   "Level reloaded:   " << changedCells <<   " cells changed,   " << reloadMs <<   " ms  " << std::endl;
+            } else {
+                std::cout <<   "[!] Reload failed:   " << levelError <<   " - keeping current level" << std::endl;
             }
+        }
+        
+        // ------- SIMULATION -------
+        // Player, enemy, coin, dan floating text maju per tick tetap;
+        // waktu game (currentTime) juga dihitung dari jumlah tick
+        prevPlayerX = playerX;
+        prevPlayerY = playerY;
+        prevCameraX = cameraX;
+        floatingTexts.prevY = floatingTexts.y;
+        
+        step(static_cast<Uint32>(simTicks * 1000 / SIM_RATE));
+        
+        // ------- STAGE TRANSITION -------
+        // Stage berikutnya sudah disiapkan di worker, jadi cukup ditukar.
+        // Layar LEVEL COMPLETE hanya untuk stage terakhir.
+        if (levelComplete && stageMode && stages.hasNext() && enterNextStage()) {
+            levelComplete = false;
+        }
+        
+        publishSnapshot();
+    }
+}
+
+void GameScene::publishSnapshot() {
+    GameSnapshot& snap = snapshots.writeSlot();
+    snap.tick = simTicks;
+    snap.simTime = static_cast<Uint32>(simTicks * 1000 / SIM_RATE);
+    
+    snap.prevCameraX = prevCameraX;
+    snap.cameraX = cameraX;
+    snap.prevPlayerX = prevPlayerX;
+    snap.prevPlayerY = prevPlayerY;
+    snap.playerX = playerX;
+    snap.playerY = playerY;
+    snap.playerVisible = !gameOver && !levelComplete;
+    snap.playerOnGround = isOnGround;
+    snap.playerFrame = static_cast<int>(std::sin(animPhase) * 3) + 3;
+    
+    snap.score = score;
+    snap.lives = lives;
+    snap.mode = gameOver ? HUD_GAME_OVER : levelComplete ? HUD_LEVEL_COMPLETE : HUD_PLAYING;
+    snap.activation = world->activationStats();
+    
+    // Area yang mungkin terlihat di antara dua tick, dengan margin
+    float viewX0 = std::min(prevCameraX, cameraX) - 100;
+    float viewX1 = std::max(prevCameraX, cameraX) + simWidth + 100;
+    snap.ground = world->groundRect(viewX0, viewX1 - viewX0);
+    world->captureTiles(viewX0, viewX1, snap.tiles);
+    
+    // Entity yang terlihat kamera, diambil dari broadphase
+    const EntityStore& coins = world->coins();
+    const EntityStore& enemies = world->enemies();
+    snap.coins.clear();
+    snap.enemies.clear();
+    snap.texts.clear();
+    SDL_Rect viewArea = {static_cast<int>(viewX0), -simHeight, static_cast<int>(viewX1 - viewX0), simHeight * 3};
+    broadphase->query(viewArea, bpMask(BP_COIN) | bpMask(BP_ENEMY) | bpMask(BP_TEXT), candidates);
+    
+    for (int id : candidates) {
+        const BroadphaseProxy& p = broadphase->proxy(id);
+        
+        if (p.layer == BP_COIN) {
+            int i = coins.indexOf(p.user);
+            if (i < 0) continue;
             
-            // ------- PHYSICS -------
-            velocityY += GRAVITY * deltaTime;
-            if (velocityY > 600.0f) velocityY = 600.0f;
-            
-            float oldX = playerX;
-            float oldY = playerY;
-            
-            playerX += velocityX * deltaTime;
-            playerY += velocityY * deltaTime;
-            
-            // ===== BATAS KIRI - Player tidak bisa mundur melewati camera =====
-            float minPlayerX = cameraX + 50.0f;  // 50px dari tepi kiri layar
-            if (playerX < minPlayerX) {
-                playerX = minPlayerX;
-            }
+            float scale = std::abs(std::cos(coins.animPhase[i]));
+            int width = static_cast<int>(16 * scale);
+            if (width < 4) width = 4;
             
-            // ===== UPDATE CAMERA - Smooth follow player =====
-            float targetCameraX = playerX - CAMERA_OFFSET_X;
-            if (targetCameraX > cameraX) {
-                cameraX = targetCameraX;
-            }
+            SnapshotCoin c = {static_cast<int>(coins.x[i]), static_cast<int>(coins.y[i]), width - 4};
+            snap.coins.push_back(c);
+        } else if (p.layer == BP_ENEMY) {
+            int i = enemies.indexOf(p.user);
+            if (i < 0) continue;
             
-            // Batas kamera tidak melewati level
-            if (cameraX < 0) cameraX = 0;
-            if (cameraX > levelWidthPixels - windowWidth) {
-                cameraX = levelWidthPixels - windowWidth;
-            }
+            SnapshotEnemy e = {enemies.prevX[i], enemies.x[i], static_cast<int>(enemies.y[i])};
+            snap.enemies.push_back(e);
+        } else if (p.layer == BP_TEXT) {
+            int i = floatingTexts.indexOf(p.user);
+            if (i < 0) continue;
             
-            // Check level complete
-            if (playerX >= levelWidthPixels - 100) {
-                levelComplete = true;
-                std::cout <<   "=== LEVEL COMPLETE! ===  " << std::endl;
-                std::cout <<   "Final Score:   " << score << std::endl;
+            SnapshotText t = {floatingTexts.x[i], floatingTexts.prevY[i], floatingTexts.y[i],
+                              floatingTexts.value[i], floatingTexts.spawnTime[i]};
+            snap.texts.push_back(t);
+        }
+    }
+    
+    snap.publishCounter = SDL_GetPerformanceCounter();
+    snapshots.publish();
+}
+
+void GameScene::step(Uint32 currentTime) {
+    const float deltaTime = SIM_TICK;
+    
+    if (!gameOver && !levelComplete) {
+        // ------- INPUT -------
+        // Di-sample thread SDL (lihat update)
+        int input = moveInput.load(std::memory_order_relaxed);
+        velocityX = 0.0f;
+    
+        if (input & INPUT_LEFT) {
+            velocityX = -MOVE_SPEED;
+            facingRight = false;
+        }
+        if (input & INPUT_RIGHT) {
+            velocityX = MOVE_SPEED;
+            facingRight = true;
+        }
+    
+        // ------- PHYSICS -------
+        velocityY += GRAVITY * deltaTime;
+        if (velocityY > 600.0f) velocityY = 600.0f;
+    
+        float oldX = playerX;
+        float oldY = playerY;
+    
+        playerX += velocityX * deltaTime;
+        playerY += velocityY * deltaTime;
+    
+        // ===== BATAS KIRI - Player tidak bisa mundur melewati camera =====
+        float minPlayerX = cameraX + 50.0f;  // 50px dari tepi kiri layar
+        if (playerX < minPlayerX) {
+            playerX = minPlayerX;
+        }
+    
+        // ===== UPDATE CAMERA - Smooth follow player =====
+        float targetCameraX = playerX - CAMERA_OFFSET_X;
+        if (targetCameraX > cameraX) {
+            cameraX = targetCameraX;
+        }
+    
+        // Batas kamera tidak melewati level
+        if (cameraX < 0) cameraX = 0;
+        if (levelWidthPixels >= 0 && cameraX > levelWidthPixels - simWidth) {
+            cameraX = levelWidthPixels - simWidth;
+        }
+    
+        // Chunk di sekitar kamera dibangun, yang sudah lewat dilepas;
+        // entity jauh dari layar tidur sampai didekati lagi
+        world->stream(cameraX, simWidth);
+        world->updateActivation(cameraX, simWidth);
+    
+        // Check level complete
+        if (levelWidthPixels >= 0 && playerX >= levelWidthPixels - 100) {
+            levelComplete = true;
+            std::cout <<   "=== LEVEL COMPLETE! ===  " << std::endl;
+            std::cout <<   "Final Score:   " << score << std::endl;
+        }
+    
+        SDL_Rect playerRect = {
+            static_cast<int>(playerX),
+            static_cast<int>(playerY),
+            PLAYER_SIZE,
+            PLAYER_SIZE
+        };
+    
+        // ===== COLLISION WITH PLATFORMS =====
+        isOnGround = false;
+    
+        // Resolve player terhadap satu collider (tile atau ground)
+        auto resolvePlatform = [&](const SDL_Rect& rect, Platform* block) {
+            bool overlapsX = playerX + PLAYER_SIZE > rect.x && 
+                            playerX < rect.x + rect.w;
+            bool overlapsY = playerY + PLAYER_SIZE > rect.y && 
+                            playerY < rect.y + rect.h;
+        
+            if (!overlapsX || !overlapsY) return;
+        
+            if (oldY + PLAYER_SIZE <= rect.y && velocityY > 0) {
+                playerY = rect.y - PLAYER_SIZE;
+                velocityY = 0;
+                isOnGround = true;
             }
+            else if (oldY >= rect.y + rect.h && velocityY < 0) {
+                playerY = rect.y + rect.h;
+                velocityY = 0;
             
-            SDL_Rect playerRect = {
-                static_cast<int>(playerX),
-                static_cast<int>(playerY),
-                PLAYER_SIZE,
-                PLAYER_SIZE
-            };
-            
-            // ===== COLLISION WITH PLATFORMS =====
-            isOnGround = false;
-            
-            for (auto& platform : platforms) {
-                bool overlapsX = playerX + PLAYER_SIZE > platform.rect.x && 
-                                playerX < platform.rect.x + platform.rect.w;
-                bool overlapsY = playerY + PLAYER_SIZE > platform.rect.y && 
-                                playerY < platform.rect.y + platform.rect.h;
+                // Hit question block from below
+                if (block && block->isBreakable && !block->isHit) {
+                    world->hitBlock(*block);
+                    score += 100;
+                    std::cout <<   "Block hit! Score:   " << score << std::endl;
                 
-                if (overlapsX && overlapsY) {
-                    if (oldY + PLAYER_SIZE <= platform.rect.y && velocityY > 0) {
-                        playerY = platform.rect.y - PLAYER_SIZE;
-                        velocityY = 0;
-                        isOnGround = true;
-                    }
-                    else if (oldY >= platform.rect.y + platform.rect.h && velocityY < 0) {
-                        playerY = platform.rect.y + platform.rect.h;
-                        velocityY = 0;
-                        
-                        // Hit question block from below
-                        if (platform.isBreakable && !platform.isHit) {
-                            platform.isHit = true;
-                            score += 100;
-                            std::cout <<   "Block hit! Score:   " << score << std::endl;
-                            
-                            // Create floating text
-                            FloatingText ft;
-                            ft.x = platform.rect.x + platform.rect.w / 2.0f;
-                            ft.y = platform.rect.y - 10.0f;
-                            ft.vy = -100.0f;
-                            ft.value = 100;
-                            ft.spawnTime = currentTime;
-                            ft.active = true;
-                            floatingTexts.push_back(ft);
-                            
-                            // Create coin that pops out
-                            Coin newCoin;
-                            newCoin.x = platform.rect.x + platform.rect.w / 2;
-                            newCoin.y = platform.rect.y - 20;
-                            newCoin.collected = false;
-                            newCoin.animPhase = 0.0f;
-                            coins.push_back(newCoin);
-                        }
-                    }
-                    else if (velocityY >= 0) {
-                        if (oldX + PLAYER_SIZE <= platform.rect.x) {
-                            playerX = platform.rect.x - PLAYER_SIZE;
-                        } else if (oldX >= platform.rect.x + platform.rect.w) {
-                            playerX = platform.rect.x + platform.rect.w;
-                        }
-                    }
+                    // Create floating text
+                    spawnFloatingText(rect.x + rect.w / 2.0f, rect.y - 10.0f, -100.0f, 100, currentTime);
+                
+                    // Create coin that pops out
+                    world->spawnCoin(rect.x + rect.w / 2, rect.y - 20);
                 }
             }
-            
-            playerRect.x = static_cast<int>(playerX);
-            playerRect.y = static_cast<int>(playerY);
-            
-            // Coin collection
-            SDL_Rect coinCollect = {playerRect.x + 4, playerRect.y + 4, playerRect.w - 8, playerRect.h - 8};
-            for (auto& coin : coins) {
-                if (!coin.collected) {
-                    SDL_Rect coinRect = {coin.x - 8, coin.y - 8, 16, 16};
-                    if (SDL_HasIntersection(&coinCollect, &coinRect)) {
-                        coin.collected = true;
-                        score += 50;
-                        std::cout <<   "Coin collected! Score:   " << score << std::endl;
-                        
-                        // Create floating text for coin
-                        FloatingText ft;
-                        ft.x = coin.x;
-                        ft.y = coin.y - 10.0f;
-                        ft.vy = -80.0f;
-                        ft.value = 50;
-                        ft.spawnTime = currentTime;
-                        ft.active = true;
-                        floatingTexts.push_back(ft);
-                    }
+            else if (velocityY >= 0) {
+                if (oldX + PLAYER_SIZE <= rect.x) {
+                    playerX = rect.x - PLAYER_SIZE;
+                } else if (oldX >= rect.x + rect.w) {
+                    playerX = rect.x + rect.w;
                 }
             }
-            
-            // Update floating texts
-            for (auto& ft : floatingTexts) {
-                if (!ft.active) continue;
-                
-                ft.y += ft.vy * deltaTime;
-                ft.vy += 50.0f * deltaTime;
-                
-                if (currentTime - ft.spawnTime > 1000) {
-                    ft.active = false;
-                }
+        };
+    
+        // Hanya collider di sekitar AABB player (+1 cell margin) yang dicek
+        world->collidersInArea(playerX - TILE_SIZE, playerY - TILE_SIZE,
+                              PLAYER_SIZE + 2 * TILE_SIZE, PLAYER_SIZE + 2 * TILE_SIZE,
+                              nearbyColliders);
+        for (const ColliderRef& ref : nearbyColliders) {
+            Platform& block = world->platform(ref);
+            resolvePlatform(block.rect, &block);
+        }
+    
+        // Ground plane - cukup bagian di bawah player
+        resolvePlatform(world->groundRect(playerX - TILE_SIZE, PLAYER_SIZE + 2 * TILE_SIZE), nullptr);
+    
+        playerRect.x = static_cast<int>(playerX);
+        playerRect.y = static_cast<int>(playerY);
+        broadphase->move(playerProxy, playerRect);
+    
+        // Coin collection - hanya coin yang overlap menurut broadphase
+        SDL_Rect coinCollect = {playerRect.x + 4, playerRect.y + 4, playerRect.w - 8, playerRect.h - 8};
+        broadphase->query(coinCollect, bpMask(BP_COIN), candidates);
+        for (int id : candidates) {
+            EntityHandle coin = broadphase->proxy(id).user;
+            int i = world->coins().indexOf(coin);
+            if (i < 0) continue;
+            float coinX = world->coins().x[i];
+            float coinY = world->coins().y[i];
+        
+            world->collectCoin(coin);
+            score += 50;
+            std::cout <<   "Coin collected! Score:   " << score << std::endl;
+        
+            // Create floating text for coin
+            spawnFloatingText(coinX, coinY - 10.0f, -80.0f, 50, currentTime);
+        }
+    
+        // Update floating texts - yang sudah habis langsung dihapus
+        // (dari belakang, swap-remove hanya memindahkan yang sudah diproses)
+        EntityStore& texts = floatingTexts;
+        for (int i = texts.size() - 1; i >= 0; i--) {
+            texts.y[i] += texts.vy[i] * deltaTime;
+            texts.vy[i] += 50.0f * deltaTime;
+        
+            if (currentTime - texts.spawnTime[i] > 1000) {
+                broadphase->remove(texts.proxy[i]);
+                texts.destroy(texts.handles[i]);
+            } else {
+                broadphase->move(texts.proxy[i], floatingTextBox(texts.x[i], texts.y[i]));
             }
+        }
+    
+        // Update enemies - yang lewat batas chunk dipindah oleh World
+        world->updateEnemies(deltaTime);
+    
+        // Enemy vs enemy - saling memantul kalau bertabrakan
+        EntityStore& enemies = world->enemies();
+        broadphase->findPairs(BP_ENEMY, BP_ENEMY, enemyPairs);
+        for (const auto& pair : enemyPairs) {
+            int a = enemies.indexOf(broadphase->proxy(pair.first).user);
+            int b = enemies.indexOf(broadphase->proxy(pair.second).user);
+            if (a < 0 || b < 0) continue;
+            int left = enemies.x[a] <= enemies.x[b] ? a : b;
+            int right = enemies.x[a] <= enemies.x[b] ? b : a;
+        
+            if (enemies.vx[left] > 0) enemies.vx[left] = -enemies.vx[left];
+            if (enemies.vx[right] < 0) enemies.vx[right] = -enemies.vx[right];
+        }
+    
+        // Enemy collision with player
+        broadphase->query(playerRect, bpMask(BP_ENEMY), candidates);
+        for (int id : candidates) {
+            const BroadphaseProxy& p = broadphase->proxy(id);
+            if (!p.alive) continue;
+        
+            int i = enemies.indexOf(p.user);
+            if (i < 0) continue;
+            int enemyX = static_cast<int>(enemies.x[i]);
+            int enemyY = static_cast<int>(enemies.y[i]);
+        
+            if (velocityY > 0 && oldY + PLAYER_SIZE <= enemyY + 10) {
+                float textX = enemyX + enemies.width[i] / 2.0f;
+                world->killEnemy(p.user);
+                velocityY = JUMP_FORCE * 0.5f;
+                score += 200;
+                std::cout <<   "Enemy defeated! Score:   " << score << std::endl;
             
-            // Update enemies
-            for (auto& enemy : enemies) {
-                if (!enemy.active) continue;
-                
-                enemy.x += enemy.vx * deltaTime;
-                
-                enemy.rect.x = static_cast<int>(enemy.x);
-                enemy.rect.y = static_cast<int>(enemy.y);
-                
-                // Bounce off level edges
-                if (enemy.x < 0 || enemy.x > levelWidthPixels - enemy.rect.w) {
-                    enemy.vx = -enemy.vx;
-                }
-                
-                // Enemy collision with player
-                if (SDL_HasIntersection(&playerRect, &enemy.rect)) {
-                    if (velocityY > 0 && oldY + PLAYER_SIZE <= enemy.rect.y + 10) {
-                        enemy.active = false;
-                        velocityY = JUMP_FORCE * 0.5f;
-                        score += 200;
-                        std::cout <<   "Enemy defeated! Score:   " << score << std::endl;
-                        
-                        // Floating text for enemy defeat
-                        FloatingText ft;
-                        ft.x = enemy.rect.x + enemy.rect.w / 2.0f;
-                        ft.y = enemy.rect.y - 10.0f;
-                        ft.vy = -120.0f;
-                        ft.value = 200;
-                        ft.spawnTime = currentTime;
-                        ft.active = true;
-                        floatingTexts.push_back(ft);
-                    }
-                    else {
-                        lives--;
-                        std::cout <<   "Hit! Lives remaining:   " << lives << std::endl;
-                        
-                        if (lives <= 0) {
-                            gameOver = true;
-                            deathTime = currentTime;
-                            std::cout <<   "Game Over! Final Score:   " << score << std::endl;
-                        } else {
-                            playerX = playerStartX;
-                            playerY = playerStartY;
-                            velocityX = 0.0f;
-                            velocityY = 0.0f;
-                            cameraX = 0.0f;
-                        }
-                    }
-                }
+                // Floating text for enemy defeat
+                spawnFloatingText(textX, enemyY - 10.0f, -120.0f, 200, currentTime);
             }
-            
-            // Fall death
-            if (playerY > windowHeight + 50) {
+            else {
                 lives--;
-                std::cout <<   "Fell! Lives remaining:   " << lives << std::endl;
-                
+                std::cout <<   "Hit! Lives remaining:   " << lives << std::endl;
+            
                 if (lives <= 0) {
                     gameOver = true;
                     deathTime = currentTime;
@@ -497,286 +909,149 @@ bool runGameBox(SDL_Renderer* renderer)
                     velocityX = 0.0f;
                     velocityY = 0.0f;
                     cameraX = 0.0f;
+                    snapInterpolation();
                 }
             }
-            
-            // Update animation
-            if (velocityX != 0 && isOnGround) {
-                animPhase += deltaTime * 10.0f;
-            }
-            
-            for (auto& coin : coins) {
-                coin.animPhase += deltaTime * 3.0f;
-            }
-        }
-        
-        // ======================================
-        // ========== RENDERING =================
-        // ======================================
-        
-        // Sky background
-        SDL_SetRenderDrawColor(renderer, 92, 148, 252, 255);
-        SDL_RenderClear(renderer);
-        
-        // Clouds with parallax
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-        for (int i = 0; i < 5; i++) {
-            int cx = static_cast<int>(200 + i * 350 - cameraX * 0.3f);
-            int cy = 80 + i * 30;
-            if (cx > -100 && cx < windowWidth + 100) {
-                SDL_Rect cloud = {cx, cy, 60, 30};
-                SDL_RenderFillRect(renderer, &cloud);
-            }
-        }
-        
-        // ===== PLATFORMS =====
-        int groundY = windowHeight - 80;
-        
-        for (const auto& platform : platforms) {
-            // Cull objects outside camera view
-            if (platform.rect.x + platform.rect.w < cameraX - 100) continue;
-            if (platform.rect.x > cameraX + windowWidth + 100) continue;
-            
-            SDL_Rect screenRect = {
-                static_cast<int>(platform.rect.x - cameraX),
-                platform.rect.y,
-                platform.rect.w,
-                platform.rect.h
-            };
-            
-            if (platform.isBreakable) {
-                // Question block
-                if (platform.isHit) {
-                    // Used block
-                    SDL_SetRenderDrawColor(renderer, 160, 130, 90, 255);
-                    SDL_RenderFillRect(renderer, &screenRect);
-                    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-                    SDL_RenderDrawRect(renderer, &screenRect);
-                } else {
-                    // Active question block
-                    SDL_SetRenderDrawColor(renderer, 243, 168, 59, 255);
-                    SDL_RenderFillRect(renderer, &screenRect);
-                    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-                    SDL_RenderDrawRect(renderer, &screenRect);
-                    
-                    // Draw   "?  "
-                    SDL_Rect qmark = {screenRect.x + 12, screenRect.y + 8, 8, 16};
-                    SDL_RenderFillRect(renderer, &qmark);
-                }
-            } 
-            else if (platform.isBrick) {
-                // Ground or brick platform
-                if (platform.rect.y >= groundY - 5) {
-                    // Ground
-                    SDL_SetRenderDrawColor(renderer, 123, 192, 67, 255);
-                    SDL_Rect grass = {screenRect.x, screenRect.y, screenRect.w, 20};
-                    SDL_RenderFillRect(renderer, &grass);
-                    
-                    SDL_SetRenderDrawColor(renderer, 139, 90, 43, 255);
-                    SDL_Rect dirt = {screenRect.x, screenRect.y + 20, screenRect.w, screenRect.h - 20};
-                    SDL_RenderFillRect(renderer, &dirt);
-                } else {
-                    // Floating platform or placed blocks
-                    SDL_SetRenderDrawColor(renderer, 184, 111, 80, 255);
-                    SDL_RenderFillRect(renderer, &screenRect);
-                    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-                    SDL_RenderDrawRect(renderer, &screenRect);
-                }
-            }
-        }
-        
-        // Coins
-        for (const auto& coin : coins) {
-            if (!coin.collected) {
-                if (coin.x < cameraX - 100 || coin.x > cameraX + windowWidth + 100) continue;
-                
-                float scale = std::abs(std::cos(coin.animPhase));
-                int width = static_cast<int>(16 * scale);
-                if (width < 4) width = 4;
-                
-                int screenX = static_cast<int>(coin.x - cameraX);
-                SDL_SetRenderDrawColor(renderer, 255, 215, 0, 255);
-                SDL_Rect coinRect = {screenX - width / 2, coin.y - 8, width, 16};
-                SDL_RenderFillRect(renderer, &coinRect);
-                
-                SDL_SetRenderDrawColor(renderer, 200, 160, 0, 255);
-                SDL_RenderDrawRect(renderer, &coinRect);
-            }
-        }
-        
-        // Enemies
-        for (const auto& enemy : enemies) {
-            if (!enemy.active) continue;
-            if (enemy.rect.x < cameraX - 100 || enemy.rect.x > cameraX + windowWidth + 100) continue;
-            
-            SDL_Rect screenRect = {
-                static_cast<int>(enemy.rect.x - cameraX),
-                enemy.rect.y,
-                enemy.rect.w,
-                enemy.rect.h
-            };
-            
-            SDL_SetRenderDrawColor(renderer, 139, 69, 19, 255);
-            SDL_RenderFillRect(renderer, &screenRect);
-            
-            // Eyes
-            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-            SDL_Rect eye1 = {screenRect.x + 6, screenRect.y + 8, 6, 6};
-            SDL_Rect eye2 = {screenRect.x + 16, screenRect.y + 8, 6, 6};
-            SDL_RenderFillRect(renderer, &eye1);
-            SDL_RenderFillRect(renderer, &eye2);
-            
-            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-            SDL_Rect pupil1 = {screenRect.x + 8, screenRect.y + 10, 3, 3};
-            SDL_Rect pupil2 = {screenRect.x + 18, screenRect.y + 10, 3, 3};
-            SDL_RenderFillRect(renderer, &pupil1);
-            SDL_RenderFillRect(renderer, &pupil2);
         }
+    
+        // Fall death
+        if (playerY > world->groundY() + world->groundHeight() + 50) {
+            lives--;
+            std::cout <<   "Fell! Lives remaining:   " << lives << std::endl;
         
-        // Player
-        if (!gameOver && !levelComplete) {
-            SDL_Rect playerScreenRect = {
-                static_cast<int>(playerX - cameraX),
-                static_cast<int>(playerY),
-                PLAYER_SIZE,
-                PLAYER_SIZE
-            };
-            
-            SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-            SDL_Rect body = {playerScreenRect.x + 4, playerScreenRect.y + 8, 24, 16};
-            SDL_RenderFillRect(renderer, &body);
-            
-            SDL_SetRenderDrawColor(renderer, 255, 200, 150, 255);
-            SDL_Rect head = {playerScreenRect.x + 8, playerScreenRect.y, 16, 16};
-            SDL_RenderFillRect(renderer, &head);
-            
-            SDL_SetRenderDrawColor(renderer, 200, 0, 0, 255);
-            SDL_Rect cap = {playerScreenRect.x + 6, playerScreenRect.y - 4, 20, 8};
-            SDL_RenderFillRect(renderer, &cap);
-            
-            SDL_SetRenderDrawColor(renderer, 0, 0, 200, 255);
-            if (isOnGround) {
-                int legOffset = static_cast<int>(std::sin(animPhase) * 3);
-                SDL_Rect leg1 = {playerScreenRect.x + 8 + legOffset, playerScreenRect.y + 24, 6, 8};
-                SDL_Rect leg2 = {playerScreenRect.x + 18 - legOffset, playerScreenRect.y + 24, 6, 8};
-                SDL_RenderFillRect(renderer, &leg1);
-                SDL_RenderFillRect(renderer, &leg2);
+            if (lives <= 0) {
+                gameOver = true;
+                deathTime = currentTime;
+                std::cout <<   "Game Over! Final Score:   " << score << std::endl;
             } else {
-                SDL_Rect leg = {playerScreenRect.x + 10, playerScreenRect.y + 24, 12, 8};
-                SDL_RenderFillRect(renderer, &leg);
-            }
-        }
-        
-        // Floating texts
-        if (smallFont) {
-            for (const auto& ft : floatingTexts) {
-                if (!ft.active) continue;
-                if (ft.x < cameraX - 100 || ft.x > cameraX + windowWidth + 100) continue;
-                
-                Uint32 age = currentTime - ft.spawnTime;
-                int alpha = 255 - (age * 255 / 1000);
-                if (alpha < 0) alpha = 0;
-                
-                char scoreStr[16];
-                snprintf(scoreStr, sizeof(scoreStr),   "+%d  ", ft.value);
-                
-                int screenX = static_cast<int>(ft.x - cameraX);
-                SDL_Color color = {255, 255, 0, static_cast<Uint8>(alpha)};
-                renderText(renderer, smallFont, scoreStr, screenX, static_cast<int>(ft.y), color, true);
+                playerX = playerStartX;
+                playerY = playerStartY;
+                velocityX = 0.0f;
+                velocityY = 0.0f;
+                cameraX = 0.0f;
+                snapInterpolation();
             }
         }
-        
-        // ===== UI =====
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
-        SDL_Rect scoreBox = {10, 10, 260, 40};
-        SDL_RenderFillRect(renderer, &scoreBox);
-        
-        SDL_SetRenderDrawColor(renderer, 255, 220, 0, 255);
-        SDL_RenderDrawRect(renderer, &scoreBox);
-        
-        if (gameFont) {
-            char scoreText[32];
-            snprintf(scoreText, sizeof(scoreText),   "SCORE: %d  ", score);
-            SDL_Color yellow = {255, 220, 0, 255};
-            renderText(renderer, gameFont, scoreText, 18, 28, yellow, false);
+    
+        // Update animation
+        if (velocityX != 0 && isOnGround) {
+            animPhase += deltaTime * 10.0f;
         }
-        
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
-        SDL_Rect livesBox = {285, 10, 250, 40};
-        SDL_RenderFillRect(renderer, &livesBox);
-        
-        SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-        SDL_RenderDrawRect(renderer, &livesBox);
-        
-        if (gameFont) {
-            SDL_Color white = {255, 255, 255, 255};
-            renderText(renderer, gameFont,   "LIVES:  ", 295, 28, white, false);
+    
+        world->updateCoins(deltaTime);
+    }
+}
+
+void GameScene::render(RenderQueue& queue) {
+    if (!ready()) return;
+    
+    // Hanya snapshot yang dibaca di sini, tidak pernah World atau state player
+    const GameSnapshot& snap = snapshots.read();
+    
+    // Posisi di antara dua tick terakhir, dari waktu sejak snapshot dipublish
+    Uint64 tickCounter = SDL_GetPerformanceFrequency() / SIM_RATE;
+    float alpha = static_cast<float>(SDL_GetPerformanceCounter() - snap.publishCounter) / tickCounter;
+    if (alpha > 1.0f) alpha = 1.0f;
+    float renderTime = snap.simTime + alpha * 1000.0f / SIM_RATE;
+    float viewX = interpolate(snap.prevCameraX, snap.cameraX, alpha);
+    
+    // Semua item masuk queue, dikirim Game sekaligus di akhir frame
+    
+    // Sky background
+    SDL_Rect sky = {0, 0, windowWidth, windowHeight};
+    queue.fillRect(LAYER_BACKGROUND, sky, SDL_Color{92, 148, 252, 255});
+    
+    // Clouds with parallax
+    for (int i = 0; i < 5; i++) {
+        int cx = static_cast<int>(200 + i * 350 - viewX * 0.3f);
+        int cy = 80 + i * 30;
+        if (cx > -100 && cx < windowWidth + 100) {
+            SDL_Rect cloud = {cx, cy, 60, 30};
+            queue.fillRect(LAYER_SKY, cloud, COLOR_WHITE);
         }
+    }
+    
+    // ===== PLATFORMS =====
+    // Layer tile dari texture per chunk (lihat ChunkTextureCache.h)
+    tileLayer->draw(queue, LAYER_TILES, snap.tiles, viewX, windowWidth);
+    
+    // Ground plane - satu span untuk seluruh lebar yang terlihat
+    const SDL_Rect& groundSpan = snap.ground;
+    if (groundSpan.w > 0) {
+        int groundY = groundSpan.y;
+        int screenX = static_cast<int>(groundSpan.x - viewX);
         
-        SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-        for (int i = 0; i < lives; i++) {
-            SDL_Rect heart = {415 + i * 32, 19, 18, 18};
-            SDL_RenderFillRect(renderer, &heart);
-        }
+        SDL_Rect grass = {screenX, groundY, groundSpan.w, 20};
+        queue.fillRect(LAYER_GROUND, grass, SDL_Color{123, 192, 67, 255});
         
-        // Level Complete Screen
-        if (levelComplete) {
-            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
-            SDL_Rect overlay = {0, 0, windowWidth, windowHeight};
-            SDL_RenderFillRect(renderer, &overlay);
-            
-            SDL_SetRenderDrawColor(renderer, 0, 139, 0, 255);
-            SDL_Rect completeBox = {windowWidth / 2 - 250, windowHeight / 2 - 100, 500, 200};
-            SDL_RenderFillRect(renderer, &completeBox);
+        // Mode native: tanah diteruskan sampai bawah layar
+        int dirtHeight = std::max(groundSpan.h, windowHeight - groundY) - 20;
+        SDL_Rect dirt = {screenX, groundY + 20, groundSpan.w, dirtHeight};
+        queue.fillRect(LAYER_GROUND, dirt, SDL_Color{139, 90, 43, 255});
+    }
+    
+    // Coins
+    for (const SnapshotCoin& coin : snap.coins) {
+        int screenX = static_cast<int>(coin.x - viewX);
+        sprites.draw(queue, LAYER_COIN, SPRITE_COIN, coin.frame, screenX, coin.y);
+    }
+    
+    // Enemies
+    for (const SnapshotEnemy& enemy : snap.enemies) {
+        int screenX = static_cast<int>(interpolate(enemy.prevX, enemy.x, alpha) - viewX);
+        sprites.draw(queue, LAYER_ENEMY, SPRITE_ENEMY, 0, screenX, enemy.y);
+    }
+    
+    // Floating texts
+    if (smallFont) {
+        for (const SnapshotText& ft : snap.texts) {
+            float age = renderTime - ft.spawnTime;
+            int fade = 255 - static_cast<int>(age * 255 / 1000);
+            if (fade < 0) fade = 0;
+            if (fade > 255) fade = 255;
             
-            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-            SDL_RenderDrawRect(renderer, &completeBox);
+            char scoreStr[16];
+            snprintf(scoreStr, sizeof(scoreStr),   "+%d  ", ft.value);
             
-            if (gameFont) {
-                SDL_Color white = {255, 255, 255, 255};
-                renderText(renderer, gameFont,   "LEVEL COMPLETE!  ", windowWidth / 2, windowHeight / 2 - 50, white, true);
-                
-                char finalScore[64];
-                snprintf(finalScore, sizeof(finalScore),   "SCORE: %d  ", score);
-                renderText(renderer, gameFont, finalScore, windowWidth / 2, windowHeight / 2, white, true);
-                
-                renderText(renderer, smallFont,   "Press ESC to exit  ", windowWidth / 2, windowHeight / 2 + 50, white, true);
-            }
+            int screenX = static_cast<int>(ft.x - viewX);
+            int screenY = static_cast<int>(interpolate(ft.prevY, ft.y, alpha));
+            SDL_Color color = {255, 255, 0, static_cast<Uint8>(fade)};
+            renderText(queue, LAYER_FLOATING_TEXT, smallText, scoreStr, screenX, screenY, color, true);
         }
+    }
+    
+    // Player
+    if (snap.playerVisible) {
+        int screenX = static_cast<int>(interpolate(snap.prevPlayerX, snap.playerX, alpha) - viewX);
+        int screenY = static_cast<int>(interpolate(snap.prevPlayerY, snap.playerY, alpha));
         
-        // Game Over Screen
-        if (gameOver) {
-            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
-            SDL_Rect overlay = {0, 0, windowWidth, windowHeight};
-            SDL_RenderFillRect(renderer, &overlay);
-            
-            SDL_SetRenderDrawColor(renderer, 139, 0, 0, 255);
-            SDL_Rect gameOverBox = {windowWidth / 2 - 250, windowHeight / 2 - 100, 500, 200};
-            SDL_RenderFillRect(renderer, &gameOverBox);
-            
-            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-            SDL_RenderDrawRect(renderer, &gameOverBox);
-            
-            if (gameFont) {
-                SDL_Color white = {255, 255, 255, 255};
-                renderText(renderer, gameFont,   "GAME OVER  ", windowWidth / 2, windowHeight / 2 - 50, white, true);
-                
-                char finalScore[64];
-                snprintf(finalScore, sizeof(finalScore),   "FINAL SCORE: %d  ", score);
-                renderText(renderer, gameFont, finalScore, windowWidth / 2, windowHeight / 2, white, true);
-            }
-            
-            if (smallFont) {
-                SDL_Color white = {255, 255, 255, 255};
-                renderText(renderer, smallFont,   "Press R to restart or ESC to exit  ", windowWidth / 2, windowHeight / 2 + 50, white, true);
-            }
+        if (snap.playerOnGround) {
+            sprites.draw(queue, LAYER_PLAYER, SPRITE_PLAYER_RUN, snap.playerFrame, screenX, screenY);
+        } else {
+            sprites.draw(queue, LAYER_PLAYER, SPRITE_PLAYER_JUMP, 0, screenX, screenY);
         }
-        
-        SDL_RenderPresent(renderer);
-        SDL_Delay(16);
     }
     
-    if (gameFont) TTF_CloseFont(gameFont);
-    if (smallFont) TTF_CloseFont(smallFont);
-    return true;
-}
\ No newline at end of file
+    // ===== UI =====
+    // Retained: texture HUD/panel digambar ulang hanya kalau nilainya berubah
+    hud->setScore(snap.score);
+    hud->setLives(snap.lives);
+    hud->setMode(snap.mode);
+    hud->draw(queue, LAYER_HUD, windowWidth, windowHeight);
+    
+    // Counter render (F3)
+    if (showRenderStats && smallFont) {
+        const RenderStats& rs = queue.stats();
+        char statsText[96];
+        snprintf(statsText, sizeof(statsText), "DRAW %d  STATE %d  CMD %d  TILE %d  HUD %d",
+                 rs.drawCalls, rs.stateChanges, rs.commands, tileLayer->stats().textureCopies,
+                 hud->stats().redraws);
+        renderText(queue, LAYER_HUD_DETAIL, smallText, statsText, 10, 70, COLOR_WHITE, false);
+        
+        // Entity aktif / tidur dan jumlah bangun / tidur sejak stage dimuat
+        const ActivationStats& as = snap.activation;
+        snprintf(statsText, sizeof(statsText), "AWAKE %d/%d  SLEEP %d/%d  WAKES %d  SLEEPS %d",
+                 as.awakeEnemies, as.awakeCoins, as.sleepingEnemies, as.sleepingCoins, as.wakes, as.sleeps);
+        renderText(queue, LAYER_HUD_DETAIL, smallText, statsText, 10, 90, COLOR_WHITE, false);
+    }
+}
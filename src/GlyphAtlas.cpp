@@ -0,0 +1,135 @@
+#include "GlyphAtlas.h"
+#include "SoftwareFramebuffer.h"
+#include <algorithm>
+
+GlyphAtlas::GlyphAtlas()
+    : font(nullptr), texture(nullptr), built(false), height(0) {
+    for (Glyph& glyph : glyphs) glyph = {{0, 0, 0, 0}, 0};
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    release();
+}
+
+void GlyphAtlas::init(TTF_Font* f) {
+    release();
+    font = f;
+    height = font ? TTF_FontHeight(font) : 0;
+
+    // Advance tidak butuh renderer, jadi lebar teks bisa diukur sebelum build
+    for (int i = 0; i < GLYPH_COUNT; i++) {
+        int advance = 0;
+        if (font) TTF_GlyphMetrics(font, static_cast<Uint16>(FIRST_CHAR + i), nullptr, nullptr, nullptr, nullptr, &advance);
+        glyphs[i] = {{0, 0, 0, 0}, advance};
+    }
+}
+
+void GlyphAtlas::release() {
+    if (texture) {
+        releaseSoftwareImage(texture);
+        SDL_DestroyTexture(texture);
+        texture = nullptr;
+    }
+    built = false;
+    layouts.clear();
+}
+
+bool GlyphAtlas::build(SDL_Renderer* renderer) {
+    // Hanya dicoba sekali; kalau gagal teks tidak digambar
+    built = true;
+    layouts.clear();
+    if (!font || !renderer) return false;
+
+    const SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface* surfaces[GLYPH_COUNT];
+
+    // Shelf packing: baris kiri ke kanan, turun kalau melewati ATLAS_MAX_WIDTH
+    int x = GLYPH_PADDING;
+    int y = GLYPH_PADDING;
+    int rowHeight = 0;
+    int atlasWidth = 1;
+    for (int i = 0; i < GLYPH_COUNT; i++) {
+        char text[2] = {static_cast<char>(FIRST_CHAR + i), '\0'};
+        surfaces[i] = text[0] == ' ' ? nullptr : TTF_RenderText_Solid(font, text, white);
+        if (!surfaces[i]) continue;
+
+        int w = surfaces[i]->w;
+        int h = surfaces[i]->h;
+        if (x + w + GLYPH_PADDING > ATLAS_MAX_WIDTH && x > GLYPH_PADDING) {
+            x = GLYPH_PADDING;
+            y += rowHeight + GLYPH_PADDING;
+            rowHeight = 0;
+        }
+        glyphs[i].src = {x, y, w, h};
+        x += w + GLYPH_PADDING;
+        rowHeight = std::max(rowHeight, h);
+        atlasWidth = std::max(atlasWidth, x);
+    }
+    int atlasHeight = y + rowHeight + GLYPH_PADDING;
+
+    SDL_Surface* atlas = SDL_CreateRGBSurfaceWithFormat(0, atlasWidth, atlasHeight, 32, SDL_PIXELFORMAT_RGBA32);
+    if (atlas) {
+        SDL_FillRect(atlas, nullptr, 0);
+        for (int i = 0; i < GLYPH_COUNT; i++) {
+            if (!surfaces[i]) continue;
+            SDL_Rect dst = glyphs[i].src;
+            SDL_BlitSurface(surfaces[i], nullptr, atlas, &dst);
+        }
+
+        texture = SDL_CreateTextureFromSurface(renderer, atlas);
+        if (texture) SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        registerSoftwareImage(texture, atlas);
+        SDL_FreeSurface(atlas);
+    }
+
+    for (SDL_Surface* surface : surfaces) {
+        if (surface) SDL_FreeSurface(surface);
+    }
+    return texture != nullptr;
+}
+
+const GlyphAtlas::TextLayout& GlyphAtlas::layoutFor(const char* text) {
+    lookupKey.assign(text);
+    auto found = layouts.find(lookupKey);
+    if (found != layouts.end()) return found->second;
+
+    if (layouts.size() >= MAX_CACHED_TEXTS) layouts.clear();
+
+    TextLayout layout;
+    layout.width = 0;
+    for (const char* c = text; *c; c++) {
+        int code = static_cast<unsigned char>(*c);
+        if (code < FIRST_CHAR || code > LAST_CHAR) code = '?';
+
+        const Glyph& glyph = glyphs[code - FIRST_CHAR];
+        if (glyph.src.w > 0) layout.quads.push_back(GlyphQuad{glyph.src, layout.width});
+        layout.width += glyph.advance;
+    }
+    return layouts.emplace(lookupKey, std::move(layout)).first->second;
+}
+
+int GlyphAtlas::textWidth(const char* text) {
+    if (!font || !text) return 0;
+
+    int width = 0;
+    for (const char* c = text; *c; c++) {
+        int code = static_cast<unsigned char>(*c);
+        if (code < FIRST_CHAR || code > LAST_CHAR) code = '?';
+        width += glyphs[code - FIRST_CHAR].advance;
+    }
+    return width;
+}
+
+void GlyphAtlas::draw(RenderQueue& queue, int layer, const char* text, int x, int y,
+                      SDL_Color color, bool centered) {
+    if (!font || !text || color.a == 0) return;
+    if (!built) build(queue.renderer());
+    if (!texture) return;
+
+    const TextLayout& layout = layoutFor(text);
+    int originX = centered ? x - layout.width / 2 : x;
+    for (const GlyphQuad& quad : layout.quads) {
+        SDL_Rect dst = {originX + quad.offsetX, y, quad.src.w, quad.src.h};
+        queue.copy(layer, texture, &quad.src, dst, color);
+    }
+}
@@ -0,0 +1,187 @@
+#include "HudLayer.h"
+#include "SoftwareFramebuffer.h"
+#include <cstdio>
+
+namespace {
+
+const int STATUS_WIDTH = 545;
+const int STATUS_HEIGHT = 60;
+const int PANEL_WIDTH = 500;
+const int PANEL_HEIGHT = 200;
+
+const SDL_Color HUD_WHITE = {255, 255, 255, 255};
+const SDL_Color HUD_YELLOW = {255, 220, 0, 255};
+const SDL_Color HUD_RED = {255, 0, 0, 255};
+const SDL_Color HUD_BOX = {0, 0, 0, 200};
+
+// y = tengah baris teks, sama seperti renderText di GameBox
+void drawHudText(RenderQueue& queue, int layer, GlyphAtlas* atlas, const char* text, int x, int y,
+                 SDL_Color color, bool centered) {
+    if (!atlas || !atlas->valid()) return;
+    atlas->draw(queue, layer, text, x, y - atlas->lineHeight() / 2, color, centered);
+}
+
+}
+
+HudLayer::HudLayer(SDL_Renderer* r)
+    : renderer(r), largeText(nullptr), smallText(nullptr),
+      targetsSupported(SDL_RenderTargetSupported(r) == SDL_TRUE && !softwareRendering),
+      score(0), lives(0), mode(HUD_PLAYING) {
+    parts[PART_STATUS] = {nullptr, STATUS_WIDTH, STATUS_HEIGHT, true};
+    parts[PART_PANEL] = {nullptr, PANEL_WIDTH, PANEL_HEIGHT, true};
+    composeQueue.init(renderer);
+    frameStats = {0, 0};
+}
+
+HudLayer::~HudLayer() {
+    for (Cache& cache : parts) {
+        if (cache.texture) SDL_DestroyTexture(cache.texture);
+    }
+}
+
+void HudLayer::init(GlyphAtlas* large, GlyphAtlas* small) {
+    largeText = large;
+    smallText = small;
+    invalidate();
+}
+
+void HudLayer::setScore(int value) {
+    if (value == score) return;
+    score = value;
+    parts[PART_STATUS].dirty = true;
+    parts[PART_PANEL].dirty = true;    // Panel menampilkan skor akhir
+}
+
+void HudLayer::setLives(int value) {
+    if (value == lives) return;
+    lives = value;
+    parts[PART_STATUS].dirty = true;
+}
+
+void HudLayer::setMode(HudMode value) {
+    if (value == mode) return;
+    mode = value;
+    parts[PART_PANEL].dirty = true;
+}
+
+void HudLayer::invalidate() {
+    for (Cache& cache : parts) cache.dirty = true;
+}
+
+// ========================================
+// Isi HUD
+// ========================================
+
+void HudLayer::composeStatus(RenderQueue& queue, int layer, int x, int y) {
+    SDL_Rect scoreBox = {x + 10, y + 10, 260, 40};
+    queue.fillRect(layer, scoreBox, HUD_BOX);
+    queue.drawRect(layer + 1, scoreBox, HUD_YELLOW);
+
+    char scoreText[32];
+    snprintf(scoreText, sizeof(scoreText),   "SCORE: %d  ", score);
+    drawHudText(queue, layer + 1, largeText, scoreText, x + 18, y + 28, HUD_YELLOW, false);
+
+    SDL_Rect livesBox = {x + 285, y + 10, 250, 40};
+    queue.fillRect(layer, livesBox, HUD_BOX);
+    queue.drawRect(layer + 1, livesBox, HUD_RED);
+
+    drawHudText(queue, layer + 1, largeText,   "LIVES:  ", x + 295, y + 28, HUD_WHITE, false);
+
+    for (int i = 0; i < lives; i++) {
+        SDL_Rect heart = {x + 415 + i * 32, y + 19, 18, 18};
+        queue.fillRect(layer + 1, heart, HUD_RED);
+    }
+}
+
+void HudLayer::composePanel(RenderQueue& queue, int layer, int x, int y) {
+    if (mode == HUD_PLAYING) return;
+
+    SDL_Rect dialogBox = {x, y, PANEL_WIDTH, PANEL_HEIGHT};
+    SDL_Color dialogColor = mode == HUD_LEVEL_COMPLETE ? SDL_Color{0, 139, 0, 255} : SDL_Color{139, 0, 0, 255};
+    queue.fillRect(layer, dialogBox, dialogColor);
+    queue.drawRect(layer + 1, dialogBox, HUD_WHITE);
+
+    int centerX = x + PANEL_WIDTH / 2;
+    int centerY = y + PANEL_HEIGHT / 2;
+    char finalScore[64];
+
+    if (mode == HUD_LEVEL_COMPLETE) {
+        drawHudText(queue, layer + 1, largeText,   "LEVEL COMPLETE!  ", centerX, centerY - 50, HUD_WHITE, true);
+
+        snprintf(finalScore, sizeof(finalScore),   "SCORE: %d  ", score);
+        drawHudText(queue, layer + 1, largeText, finalScore, centerX, centerY, HUD_WHITE, true);
+
+        drawHudText(queue, layer + 1, smallText,   "Press ESC to exit  ", centerX, centerY + 50, HUD_WHITE, true);
+    } else {
+        drawHudText(queue, layer + 1, largeText,   "GAME OVER  ", centerX, centerY - 50, HUD_WHITE, true);
+
+        snprintf(finalScore, sizeof(finalScore),   "FINAL SCORE: %d  ", score);
+        drawHudText(queue, layer + 1, largeText, finalScore, centerX, centerY, HUD_WHITE, true);
+
+        drawHudText(queue, layer + 1, smallText,   "Press R to restart or ESC to exit  ", centerX, centerY + 50, HUD_WHITE, true);
+    }
+}
+
+void HudLayer::compose(Part part, RenderQueue& queue, int layer, int x, int y) {
+    if (part == PART_STATUS) composeStatus(queue, layer, x, y);
+    else composePanel(queue, layer, x, y);
+}
+
+// ========================================
+// Cache texture
+// ========================================
+
+bool HudLayer::refresh(Part part) {
+    Cache& cache = parts[part];
+    if (!targetsSupported) return false;
+
+    if (!cache.texture) {
+        cache.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                          cache.width, cache.height);
+        if (!cache.texture) {
+            // Pakai jalur langsung seterusnya
+            targetsSupported = false;
+            return false;
+        }
+        SDL_SetTextureBlendMode(cache.texture, SDL_BLENDMODE_BLEND);
+        cache.dirty = true;
+    }
+    if (!cache.dirty) return true;
+
+    SDL_Texture* previous = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, cache.texture);
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    compose(part, composeQueue, 0, 0, 0);
+    composeQueue.flush();
+
+    SDL_SetRenderTarget(renderer, previous);
+    cache.dirty = false;
+    frameStats.redraws++;
+    return true;
+}
+
+void HudLayer::drawPart(Part part, RenderQueue& queue, int layer, int x, int y) {
+    if (refresh(part)) {
+        const Cache& cache = parts[part];
+        SDL_Rect dst = {x, y, cache.width, cache.height};
+        queue.copy(layer, cache.texture, nullptr, dst);
+        frameStats.textureCopies++;
+    } else {
+        compose(part, queue, layer, x, y);
+    }
+}
+
+void HudLayer::draw(RenderQueue& queue, int layer, int viewWidth, int viewHeight) {
+    frameStats = {0, 0};
+
+    drawPart(PART_STATUS, queue, layer, 0, 0);
+
+    if (mode != HUD_PLAYING) {
+        SDL_Rect overlay = {0, 0, viewWidth, viewHeight};
+        queue.fillRect(layer + 2, overlay, HUD_BOX);
+
+        drawPart(PART_PANEL, queue, layer + 3, viewWidth / 2 - PANEL_WIDTH / 2, viewHeight / 2 - PANEL_HEIGHT / 2);
+    }
+}
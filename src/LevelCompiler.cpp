@@ -0,0 +1,165 @@
+#include "LevelCompiler.h"
+#include "LevelFormat.h"
+#include "LevelParse.h"
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+static uint32_t alignUp(uint32_t value) {
+    return (value + 3u) & ~3u;
+}
+
+bool parseLevel(const std::vector<std::string>& rows, int tileSize,
+                ParsedLevel& level, std::string& error) {
+    if (rows.empty()) {
+        error = "level is empty";
+        return false;
+    }
+    if (tileSize <= 0) {
+        error = "invalid tile size";
+        return false;
+    }
+
+    uint32_t numRows = static_cast<uint32_t>(rows.size());
+    uint32_t numCols = 0;
+    for (const auto& row : rows) {
+        if (row.length() > numCols) numCols = static_cast<uint32_t>(row.length());
+    }
+    if (numCols == 0) {
+        error = "level has no columns";
+        return false;
+    }
+
+    level.cols = numCols;
+    level.rows = numRows;
+    level.tiles.assign(static_cast<size_t>(numCols) * numRows, TILE_EMPTY);
+    level.coins.clear();
+    level.enemies.clear();
+    level.hasPlayer = false;
+    level.playerX = 0;
+    level.playerY = 0;
+
+    for (uint32_t row = 0; row < numRows; row++) {
+        const std::string& line = rows[row];
+
+        for (uint32_t col = 0; col < line.length(); col++) {
+            int32_t x = static_cast<int32_t>(col) * tileSize;
+            int32_t y = static_cast<int32_t>(row) * tileSize;
+            uint8_t& tile = level.tiles[row * numCols + col];
+
+            switch (classifyLevelChar(line[col])) {
+                case LEVEL_CHAR_TILE:
+                    tile = levelTileFor(line[col]);
+                    break;
+
+                case LEVEL_CHAR_COIN: {
+                    LevelCoinSpawn coin = {x + tileSize / 2, y + tileSize / 2};
+                    level.coins.push_back(coin);
+                    break;
+                }
+                case LEVEL_CHAR_ENEMY: {
+                    LevelEnemySpawn enemy = {x, y, levelEnemySpeedFor(line[col])};
+                    level.enemies.push_back(enemy);
+                    break;
+                }
+                case LEVEL_CHAR_PLAYER:
+                    if (level.hasPlayer) {
+                        std::ostringstream msg;
+                        msg << "row " << row + 1 << ", col " << col + 1 << ": duplicate player start 'P'";
+                        error = msg.str();
+                        return false;
+                    }
+                    level.hasPlayer = true;
+                    level.playerX = x;
+                    level.playerY = y;
+                    break;
+
+                case LEVEL_CHAR_EMPTY:
+                    break;
+
+                case LEVEL_CHAR_INVALID: {
+                    std::ostringstream msg;
+                    msg << "row " << row + 1 << ", col " << col + 1
+                        << ": unknown tile '" << line[col] << "'";
+                    error = msg.str();
+                    return false;
+                }
+            }
+        }
+    }
+
+    // Spawn table diurutkan berdasarkan x supaya bisa dicari per area
+    std::stable_sort(level.coins.begin(), level.coins.end(),
+                     [](const LevelCoinSpawn& a, const LevelCoinSpawn& b) { return a.x < b.x; });
+    std::stable_sort(level.enemies.begin(), level.enemies.end(),
+                     [](const LevelEnemySpawn& a, const LevelEnemySpawn& b) { return a.x < b.x; });
+
+    // Precomputed collision data
+    level.colliders.clear();
+    level.colliderGrid.assign(level.tiles.size(), LEVEL_NO_COLLIDER);
+    std::vector<LevelCollider>& colliders = level.colliders;
+    auto emit = [&colliders](const LevelCollider& collider) {
+        colliders.push_back(collider);
+        return static_cast<uint32_t>(colliders.size() - 1);
+    };
+    mergeLevelColliders(level.tiles, numCols, numRows, tileSize, level.colliderGrid, emit);
+    return true;
+}
+
+bool compileLevel(const std::vector<std::string>& rows, int tileSize,
+                  std::vector<uint8_t>& image, std::string& error) {
+    image.clear();
+
+    ParsedLevel level;
+    if (!parseLevel(rows, tileSize, level, error)) return false;
+
+    if (!level.hasPlayer) {
+        error = "level has no player start 'P'";
+        return false;
+    }
+
+    uint32_t numCols = level.cols;
+    uint32_t numRows = level.rows;
+    const std::vector<LevelCollider>& colliders = level.colliders;
+    const std::vector<LevelCoinSpawn>& coins = level.coins;
+    const std::vector<LevelEnemySpawn>& enemies = level.enemies;
+
+    // Layout section
+    uint32_t cellCount = numCols * numRows;
+    LevelFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, LEVEL_MAGIC, sizeof(header.magic));
+    header.version = LEVEL_FORMAT_VERSION;
+    header.tileSize = static_cast<uint32_t>(tileSize);
+    header.cols = numCols;
+    header.rows = numRows;
+    header.playerX = level.playerX;
+    header.playerY = level.playerY;
+    header.groundHeight = LEVEL_GROUND_HEIGHT;
+    header.tilesOffset = alignUp(sizeof(LevelFileHeader));
+    header.colliderCount = static_cast<uint32_t>(colliders.size());
+    header.collidersOffset = alignUp(header.tilesOffset + cellCount);
+    header.colliderGridOffset = alignUp(header.collidersOffset + header.colliderCount * sizeof(LevelCollider));
+    header.coinCount = static_cast<uint32_t>(coins.size());
+    header.coinsOffset = alignUp(header.colliderGridOffset + cellCount * sizeof(uint32_t));
+    header.enemyCount = static_cast<uint32_t>(enemies.size());
+    header.enemiesOffset = alignUp(header.coinsOffset + header.coinCount * sizeof(LevelCoinSpawn));
+    header.fileSize = alignUp(header.enemiesOffset + header.enemyCount * sizeof(LevelEnemySpawn));
+
+    image.assign(header.fileSize, 0);
+    std::memcpy(&image[0], &header, sizeof(header));
+    std::memcpy(&image[header.tilesOffset], &level.tiles[0], cellCount);
+
+    if (!colliders.empty()) {
+        std::memcpy(&image[header.collidersOffset], &colliders[0], colliders.size() * sizeof(LevelCollider));
+    }
+    std::memcpy(&image[header.colliderGridOffset], &level.colliderGrid[0], cellCount * sizeof(uint32_t));
+    if (!coins.empty()) {
+        std::memcpy(&image[header.coinsOffset], &coins[0], coins.size() * sizeof(LevelCoinSpawn));
+    }
+    if (!enemies.empty()) {
+        std::memcpy(&image[header.enemiesOffset], &enemies[0], enemies.size() * sizeof(LevelEnemySpawn));
+    }
+
+    return true;
+}
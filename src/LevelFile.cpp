@@ -0,0 +1,202 @@
+#include "LevelFile.h"
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ========================================
+// MappedFile
+// ========================================
+
+MappedFile::MappedFile()
+    : mapped(nullptr), length(0)
+#ifdef _WIN32
+    , fileHandle(nullptr), mappingHandle(nullptr)
+#endif
+{
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string& path, std::string& error) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        error = "cannot open " + path;
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        error = "cannot read size of " + path;
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        error = "cannot map " + path;
+        return false;
+    }
+
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        error = "cannot map " + path;
+        return false;
+    }
+
+    fileHandle = file;
+    mappingHandle = mapping;
+    mapped = view;
+    length = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "cannot open " + path;
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        error = "cannot read size of " + path;
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);  // Mapping tetap valid setelah fd ditutup
+    if (view == MAP_FAILED) {
+        error = "cannot map " + path;
+        return false;
+    }
+
+    mapped = view;
+    length = static_cast<size_t>(st.st_size);
+#endif
+
+    return true;
+}
+
+void MappedFile::close() {
+    if (!mapped) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(mapped);
+    CloseHandle(static_cast<HANDLE>(mappingHandle));
+    CloseHandle(static_cast<HANDLE>(fileHandle));
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    munmap(const_cast<void*>(mapped), length);
+#endif
+
+    mapped = nullptr;
+    length = 0;
+}
+
+void MappedFile::prefault() const {
+    const volatile uint8_t* bytes = static_cast<const volatile uint8_t*>(mapped);
+    uint8_t sum = 0;
+    for (size_t offset = 0; offset < length; offset += 4096) sum += bytes[offset];
+    (void)sum;
+}
+
+// ========================================
+// LevelView
+// ========================================
+
+LevelView::LevelView()
+    : header(nullptr), tiles(nullptr), colliders(nullptr), colliderGrid(nullptr),
+      coins(nullptr), enemies(nullptr) {
+}
+
+// Section [offset, offset + bytes) harus berada di dalam image
+static bool sectionFits(uint32_t offset, uint64_t bytes, size_t size) {
+    return offset <= size && bytes <= size - offset;
+}
+
+bool LevelView::bind(const void* data, size_t size, std::string& error) {
+    *this = LevelView();
+
+    if (!data || size < sizeof(LevelFileHeader)) {
+        error = "file too small";
+        return false;
+    }
+
+    const LevelFileHeader* h = static_cast<const LevelFileHeader*>(data);
+    if (std::memcmp(h->magic, LEVEL_MAGIC, sizeof(h->magic)) != 0) {
+        error = "not a level file";
+        return false;
+    }
+    if (h->version != LEVEL_FORMAT_VERSION) {
+        error = "unsupported level version " + std::to_string(h->version) +
+                " (expected " + std::to_string(LEVEL_FORMAT_VERSION) + ")";
+        return false;
+    }
+    if (h->fileSize != size) {
+        error = "truncated level file";
+        return false;
+    }
+    if (h->cols == 0 || h->rows == 0 || h->tileSize == 0) {
+        error = "empty level";
+        return false;
+    }
+
+    uint64_t cellCount = static_cast<uint64_t>(h->cols) * h->rows;
+    bool aligned = (h->collidersOffset % 4) == 0 && (h->colliderGridOffset % 4) == 0 &&
+                   (h->coinsOffset % 4) == 0 && (h->enemiesOffset % 4) == 0;
+    if (!aligned ||
+        !sectionFits(h->tilesOffset, cellCount, size) ||
+        !sectionFits(h->collidersOffset, static_cast<uint64_t>(h->colliderCount) * sizeof(LevelCollider), size) ||
+        !sectionFits(h->colliderGridOffset, cellCount * sizeof(uint32_t), size) ||
+        !sectionFits(h->coinsOffset, static_cast<uint64_t>(h->coinCount) * sizeof(LevelCoinSpawn), size) ||
+        !sectionFits(h->enemiesOffset, static_cast<uint64_t>(h->enemyCount) * sizeof(LevelEnemySpawn), size)) {
+        error = "corrupt section table";
+        return false;
+    }
+
+    const uint8_t* base = static_cast<const uint8_t*>(data);
+    header = h;
+    tiles = base + h->tilesOffset;
+    colliders = reinterpret_cast<const LevelCollider*>(base + h->collidersOffset);
+    colliderGrid = reinterpret_cast<const uint32_t*>(base + h->colliderGridOffset);
+    coins = reinterpret_cast<const LevelCoinSpawn*>(base + h->coinsOffset);
+    enemies = reinterpret_cast<const LevelEnemySpawn*>(base + h->enemiesOffset);
+    return true;
+}
+
+// ========================================
+// LevelFile
+// ========================================
+
+bool LevelFile::open(const std::string& path, std::string& error) {
+    close();
+
+    if (!file.open(path, error)) return false;
+
+    if (!levelView.bind(file.data(), file.size(), error)) {
+        error = path + ": " + error;
+        file.close();
+        return false;
+    }
+    return true;
+}
+
+void LevelFile::close() {
+    levelView = LevelView();
+    file.close();
+}
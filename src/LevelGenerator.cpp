@@ -0,0 +1,268 @@
+#include "LevelGenerator.h"
+#include "LevelCompiler.h"
+#include <algorithm>
+#include <climits>
+
+// Jarak spawnId antar section, supaya state permanen (coin/enemy)
+// tiap section tidak bertabrakan
+static const int SECTION_SPAWN_STRIDE = 1024;
+
+// Lebar satu "slot" fitur di dalam section (tile)
+static const int FEATURE_WIDTH = 8;
+
+// RNG sendiri (splitmix64), bukan std::mt19937 + distribution:
+// distribution standar boleh beda antar implementasi library,
+// sedangkan seed yang sama harus selalu menghasilkan level yang sama.
+namespace {
+struct SectionRandom {
+    uint64_t state;
+
+    SectionRandom(uint32_t seed, int index)
+        : state((static_cast<uint64_t>(seed) << 32) ^ static_cast<uint64_t>(static_cast<uint32_t>(index))) {
+        next();
+    }
+
+    uint64_t next() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Inklusif [lo, hi]
+    int range(int lo, int hi) {
+        return lo + static_cast<int>(next() % static_cast<uint64_t>(hi - lo + 1));
+    }
+
+    bool chance(int percent) { return range(0, 99) < percent; }
+};
+}
+
+void generateSection(uint32_t seed, int index, int cols, int rows,
+                     std::vector<std::string>& out) {
+    out.assign(rows, std::string(cols, ' '));
+    if (rows < 8 || cols <= 0) return;
+
+    SectionRandom rng(seed, index);
+
+    // Baris paling bawah = baris spawn enemy (sama dengan mainLevel)
+    int floorRow = rows - 1;
+
+    for (int slot = 0; slot * FEATURE_WIDTH < cols; slot++) {
+        int x0 = slot * FEATURE_WIDTH;
+        int width = std::min(FEATURE_WIDTH, cols - x0);
+        if (width < 4) continue;
+
+        // Awal level dibiarkan kosong supaya player tidak langsung kena
+        // enemy atau terjepit di dalam ground block
+        bool safeStart = index == 0 && slot < 2;
+
+        int feature = rng.range(0, 99);
+        if (feature < 25) {
+            // Platform brick melayang, kadang dengan coin di atasnya
+            int row = floorRow - rng.range(2, 3);
+            int length = rng.range(3, std::min(6, width));
+            int col = x0 + rng.range(0, width - length);
+            for (int i = 0; i < length; i++) out[row][col + i] = 'B';
+            if (rng.chance(50)) {
+                for (int i = 1; i < length - 1; i++) out[row - 2][col + i] = 'C';
+            }
+        } else if (feature < 45) {
+            // Deret '?' (kadang diselingi brick) yang bisa dipukul dari ground
+            int row = floorRow - 5;
+            int count = rng.range(1, 3);
+            int col = x0 + 1;
+            for (int i = 0; i < count && col < x0 + width; i++, col += 2) {
+                out[row][col] = '?';
+                if (col + 1 < x0 + width && rng.chance(40)) out[row][col + 1] = 'B';
+            }
+        } else if (feature < 60) {
+            // Tumpukan ground block. Angka acak tetap diambil di awal level
+            // supaya slot berikutnya sama persis untuk seed yang sama.
+            int height = rng.range(1, 3);
+            int length = rng.range(2, 4);
+            int col = x0 + rng.range(0, width - length);
+            for (int i = 0; i < length && !safeStart; i++) {
+                for (int h = 0; h < height; h++) out[floorRow - h][col + i] = 'G';
+            }
+        } else if (feature < 75) {
+            // Deret coin
+            int row = floorRow - rng.range(2, 5);
+            int length = rng.range(3, 5);
+            int col = x0 + rng.range(0, width - length);
+            for (int i = 0; i < length; i++) out[row][col + i] = 'C';
+        }
+
+        // Enemy di slot ini, tidak di dalam tumpukan ground
+        if (!safeStart && rng.chance(35)) {
+            int col = x0 + rng.range(0, width - 1);
+            if (out[floorRow][col] == ' ') {
+                out[floorRow][col] = rng.chance(50) ? 'E' : 'e';
+            }
+        }
+    }
+}
+
+// ========================================
+// GeneratedChunkSource
+// ========================================
+
+GeneratedChunkSource::GeneratedChunkSource(uint32_t seed, int rows, int tileSize, int aheadChunks)
+    : levelSeed(seed), numRows(rows), size(tileSize), ahead(aheadChunks),
+      stopping(false), chunkCols(0), anchor(0), inProgress(INT_MIN) {
+    worker = std::thread(&GeneratedChunkSource::workerLoop, this);
+}
+
+GeneratedChunkSource::~GeneratedChunkSource() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    worker.join();
+}
+
+int GeneratedChunkSource::groundHeight() const {
+    return static_cast<int>(LEVEL_GROUND_HEIGHT);
+}
+
+void GeneratedChunkSource::playerStart(float& x, float& y) const {
+    x = 2.0f * size;
+    y = static_cast<float>((numRows - 1) * size);
+}
+
+bool GeneratedChunkSource::buildChunk(int index, int cols, LevelChunk& chunk) {
+    std::lock_guard<std::mutex> guard(lock);
+
+    std::map<int, LevelChunk>::iterator it = ready.find(index);
+    if (it == ready.end() || cols != chunkCols) {
+        request(index, cols);
+        return false;
+    }
+
+    // Ambil section yang sudah jadi - hanya swap vector, tanpa generate
+    std::swap(chunk, it->second);
+    ready.erase(it);
+
+    anchor = index;
+    wake.notify_one();
+    return true;
+}
+
+int GeneratedChunkSource::spawnIdFloor(int index) const {
+    // Satu chunk = satu section
+    return std::max(index, 0) * SECTION_SPAWN_STRIDE;
+}
+
+void GeneratedChunkSource::waitForChunk(int index, int cols) {
+    std::unique_lock<std::mutex> guard(lock);
+    request(index, cols);
+    finished.wait(guard, [&]() { return ready.count(index) != 0; });
+}
+
+// Dipanggil dengan lock dipegang
+void GeneratedChunkSource::request(int index, int cols) {
+    if (cols != chunkCols) {
+        ready.clear();
+        requests.clear();
+        chunkCols = cols;
+    }
+
+    anchor = index;
+    if (index != inProgress && std::find(requests.begin(), requests.end(), index) == requests.end()) {
+        requests.push_back(index);
+    }
+
+    // Section yang sudah jauh dari kamera dibuang; bisa di-generate ulang
+    // kapan saja karena hasilnya deterministik
+    for (std::map<int, LevelChunk>::iterator it = ready.begin(); it != ready.end();) {
+        if (it->first < anchor - ahead || it->first > anchor + 2 * ahead) {
+            it = ready.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    wake.notify_one();
+}
+
+// Dipanggil dengan lock dipegang
+bool GeneratedChunkSource::nextJob(int& index) {
+    if (chunkCols <= 0) return false;
+
+    // Chunk yang sedang ditunggu World dulu
+    while (!requests.empty()) {
+        int wanted = requests.front();
+        requests.erase(requests.begin());
+        if (wanted >= 0 && !ready.count(wanted)) {
+            index = wanted;
+            return true;
+        }
+    }
+
+    // Lalu prefetch beberapa chunk di depan
+    for (int i = anchor + 1; i <= anchor + ahead; i++) {
+        if (i >= 0 && !ready.count(i)) {
+            index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+void GeneratedChunkSource::workerLoop() {
+    std::vector<std::string> rowsScratch;
+    std::unique_lock<std::mutex> guard(lock);
+
+    while (true) {
+        int index = 0;
+        wake.wait(guard, [&]() { return stopping || nextJob(index); });
+        if (stopping) return;
+
+        int cols = chunkCols;
+        inProgress = index;
+        guard.unlock();
+
+        LevelChunk chunk;
+        buildSection(index, cols, chunk, rowsScratch);
+
+        guard.lock();
+        inProgress = INT_MIN;
+        if (cols == chunkCols) {
+            std::swap(ready[index], chunk);
+        }
+        finished.notify_all();
+    }
+}
+
+void GeneratedChunkSource::buildSection(int index, int cols, LevelChunk& chunk,
+                                        std::vector<std::string>& rowsScratch) {
+    int startX = index * cols * size;
+    resetChunk(chunk, index, startX, cols, numRows, size);
+
+    generateSection(levelSeed, index, cols, numRows, rowsScratch);
+
+    ParsedLevel section;
+    std::string error;
+    if (!parseLevel(rowsScratch, size, section, error)) return;
+
+    std::copy(section.tiles.begin(), section.tiles.end(), chunk.tiles.begin());
+
+    for (const LevelCollider& c : section.colliders) {
+        Platform p;
+        p.rect = {c.x + startX, c.y, c.w, c.h};
+        p.isBreakable = (c.flags & LEVEL_COLLIDE_BUMP) != 0;
+        p.isBrick = !p.isBreakable;
+        p.isHit = false;
+        chunk.platforms.push_back(p);
+    }
+    indexChunkColliders(chunk, size);
+
+    int spawnBase = index * SECTION_SPAWN_STRIDE;
+    for (size_t i = 0; i < section.coins.size(); i++) {
+        chunk.coins.push_back(makeCoin(section.coins[i], startX, spawnBase + static_cast<int>(i)));
+    }
+    for (size_t i = 0; i < section.enemies.size(); i++) {
+        chunk.enemies.push_back(makeEnemy(section.enemies[i], startX, spawnBase + static_cast<int>(i)));
+    }
+}
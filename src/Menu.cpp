@@ -1,4 +1,6 @@
 #include "Menu.h"
+#include "SoftwareFramebuffer.h"
+#include <algorithm>
 #include <iostream>
 #include <cmath>
 #include <cstdlib>
@@ -7,7 +9,9 @@
 Menu::Menu() 
     : selectedItem(0), titleFont(nullptr), itemFont(nullptr), smallFont(nullptr),
       pulsePhase(0.0f), fadeIn(0.0f), lastSelectTime(0), lastKeyTime(0),
-      windowWidth(800), windowHeight(600), coinRotation(0.0f) {
+      windowWidth(800), windowHeight(600), coinRotation(0.0f),
+      cacheRenderer(nullptr), skyTexture(nullptr), groundTexture(nullptr),
+      cacheWidth(0), cacheHeight(0) {
     std::srand(static_cast<unsigned>(std::time(nullptr)));
 }
 
@@ -19,6 +23,10 @@ bool Menu::init(int wWidth, int wHeight) {
     windowWidth = wWidth;
     windowHeight = wHeight;
     
+    // init bisa dipanggil ulang (ganti ukuran window) - tutup font lama dulu.
+    // Cache texture tetap; dibangun ulang di render kalau ukurannya berubah.
+    closeFonts();
+    
     // Try to load fonts with multiple fallback paths
     const char* font_paths[] = {
         "assets/PressStart2P-Regular.ttf",
@@ -50,6 +58,11 @@ bool Menu::init(int wWidth, int wHeight) {
         std::cerr << "Warning: Some fonts failed to load. Install DejaVu fonts or add PressStart2P font." << std::endl;
     }
     
+    // Atlas glyph dibangun saat teks pertama digambar
+    titleText.init(titleFont);
+    itemText.init(itemFont);
+    smallText.init(smallFont);
+    
     // Create menu items centered on screen
     int startY = windowHeight / 2 + 20;
     int spacing = 70;
@@ -81,6 +94,10 @@ void Menu::initClouds() {
 }
 
 void Menu::handleEvent(SDL_Event& e, GameState& state, bool& running) {
+    if (e.type == SDL_RENDER_TARGETS_RESET || e.type == SDL_RENDER_DEVICE_RESET) {
+        invalidateCache();
+    }
+    
     if (e.type == SDL_KEYDOWN) {
         handleKeyboard(e);
         if (e.key.keysym.sym == SDLK_RETURN || e.key.keysym.sym == SDLK_SPACE) {
@@ -119,8 +136,9 @@ void Menu::handleKeyboard(SDL_Event& e) {
 
 void Menu::handleMouse(SDL_Event& e, GameState& state, bool& running) {
     if (e.type == SDL_MOUSEMOTION || e.type == SDL_MOUSEBUTTONDOWN) {
-        int mx, my;
-        SDL_GetMouseState(&mx, &my);
+        // Koordinat event sudah di ruang canvas (lihat main.cpp)
+        int mx = e.type == SDL_MOUSEMOTION ? e.motion.x : e.button.x;
+        int my = e.type == SDL_MOUSEMOTION ? e.motion.y : e.button.y;
         
         for (size_t i = 0; i < items.size(); i++) {
             SDL_Rect& r = items[i].rect;
@@ -196,39 +214,67 @@ void Menu::update(float deltaTime) {
     }
 }
 
-void Menu::render(SDL_Renderer* renderer) {
-    renderBackground(renderer);
-    renderClouds(renderer);
-    renderGround(renderer);
-    renderTitle(renderer);
-    renderItems(renderer);
+// Layer render menu (lihat RenderQueue.h)
+enum MenuLayer {
+    MENU_LAYER_SKY,
+    MENU_LAYER_CLOUD,
+    MENU_LAYER_GROUND,
+    MENU_LAYER_GROUND_DETAIL,
+    MENU_LAYER_TITLE_SHADOW,
+    MENU_LAYER_TITLE,
+    MENU_LAYER_ITEM,
+    MENU_LAYER_ITEM_DETAIL,
+    MENU_LAYER_ITEM_TEXT,
+    MENU_LAYER_COIN,
+    MENU_LAYER_FOOTER
+};
+
+// Warna dan ukuran elemen statis
+const SDL_Color SKY_TOP = {92, 148, 252, 255};
+const SDL_Color SKY_BOTTOM = {102, 168, 212, 255};
+const SDL_Color GRASS_COLOR = {123, 192, 67, 255};
+const SDL_Color DIRT_COLOR = {139, 90, 43, 255};
+const SDL_Color BLADE_COLOR = {100, 160, 50, 255};
+const int GROUND_HEIGHT = 100;
+const int BLADE_HEIGHT = 12;
+
+void Menu::render(RenderQueue& queue) {
+    if (queue.renderer() != cacheRenderer || cacheWidth != windowWidth || cacheHeight != windowHeight) {
+        buildCaches(queue.renderer());
+    }
+    if (!sprites.valid()) sprites.init(queue.renderer());
+    
+    renderBackground(queue);
+    renderClouds(queue);
+    renderGround(queue);
+    renderTitle(queue);
+    renderItems(queue);
     
     // Coins decoration
-    renderCoin(renderer, windowWidth / 2 - 200, windowHeight / 2 - 100, coinRotation);
-    renderCoin(renderer, windowWidth / 2 + 200, windowHeight / 2 - 100, coinRotation + 1.0f);
+    renderCoin(queue, windowWidth / 2 - 200, windowHeight / 2 - 100, coinRotation);
+    renderCoin(queue, windowWidth / 2 + 200, windowHeight / 2 - 100, coinRotation + 1.0f);
     
     // Version info
     if (smallFont) {
         SDL_Color white = {255, 255, 255, 200};
-        renderText(renderer, "v1.0 - Arrow Keys/WASD to navigate - ENTER to select", 
-                windowWidth / 2, windowHeight - 25, smallFont, white, true);
+        renderText(queue, MENU_LAYER_FOOTER, "v1.0 - Arrow Keys/WASD to navigate - ENTER to select", 
+                windowWidth / 2, windowHeight - 25, smallText, white, true);
     }
 }
 
-void Menu::renderBackground(SDL_Renderer* renderer) {
-    // Sky blue gradient (Mario sky)
-    for (int y = 0; y < windowHeight - 100; ++y) {
-        float t = static_cast<float>(y) / (windowHeight - 100);
-        Uint8 r = static_cast<Uint8>(92 + t * 10);
-        Uint8 g = static_cast<Uint8>(148 + t * 20);
-        Uint8 b = static_cast<Uint8>(252 - t * 40);
-        SDL_SetRenderDrawColor(renderer, r, g, b, 255);
-        SDL_RenderDrawLine(renderer, 0, y, windowWidth, y);
+void Menu::renderBackground(RenderQueue& queue) {
+    SDL_Rect sky = {0, 0, windowWidth + 1, windowHeight - GROUND_HEIGHT};
+    if (skyTexture) {
+        // Texture 1 pixel per baris, di-stretch horizontal
+        queue.copy(MENU_LAYER_SKY, skyTexture, nullptr, sky);
+    } else {
+        // Sky blue gradient (Mario sky) - satu quad
+        queue.fillGradient(MENU_LAYER_SKY, sky, SKY_TOP, SKY_BOTTOM);
     }
 }
 
-void Menu::renderClouds(SDL_Renderer* renderer) {
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+void Menu::renderClouds(RenderQueue& queue) {
+    SDL_Color white = {255, 255, 255, 255};
     
     for (const auto& cloud : clouds) {
         // Simple cloud shape (3 circles approximated with rects)
@@ -242,33 +288,36 @@ void Menu::renderClouds(SDL_Renderer* renderer) {
         };
         
         for (const auto& part : parts) {
-            SDL_RenderFillRect(renderer, &part);
+            queue.fillRect(MENU_LAYER_CLOUD, part, white);
         }
     }
 }
 
-void Menu::renderGround(SDL_Renderer* renderer) {
-    int groundY = windowHeight - 100;
+void Menu::renderGround(RenderQueue& queue) {
+    int groundY = windowHeight - GROUND_HEIGHT;
+    
+    if (groundTexture) {
+        SDL_Rect dst = {0, groundY - BLADE_HEIGHT, windowWidth, GROUND_HEIGHT + BLADE_HEIGHT};
+        queue.copy(MENU_LAYER_GROUND, groundTexture, nullptr, dst);
+        return;
+    }
     
     // Green ground
-    SDL_SetRenderDrawColor(renderer, 123, 192, 67, 255);
-    SDL_Rect ground = {0, groundY, windowWidth, 100};
-    SDL_RenderFillRect(renderer, &ground);
+    SDL_Rect ground = {0, groundY, windowWidth, GROUND_HEIGHT};
+    queue.fillRect(MENU_LAYER_GROUND, ground, GRASS_COLOR);
     
     // Brown dirt layer
-    SDL_SetRenderDrawColor(renderer, 139, 90, 43, 255);
     SDL_Rect dirt = {0, groundY + 40, windowWidth, 60};
-    SDL_RenderFillRect(renderer, &dirt);
+    queue.fillRect(MENU_LAYER_GROUND_DETAIL, dirt, DIRT_COLOR);
     
     // Grass blades (simple lines)
-    SDL_SetRenderDrawColor(renderer, 100, 160, 50, 255);
     for (int x = 0; x < windowWidth; x += 20) {
-        SDL_RenderDrawLine(renderer, x, groundY, x, groundY - 8);
-        SDL_RenderDrawLine(renderer, x + 10, groundY, x + 10, groundY - 12);
+        queue.drawLine(MENU_LAYER_GROUND_DETAIL, x, groundY, x, groundY - 8, BLADE_COLOR);
+        queue.drawLine(MENU_LAYER_GROUND_DETAIL, x + 10, groundY, x + 10, groundY - BLADE_HEIGHT, BLADE_COLOR);
     }
 }
 
-void Menu::renderTitle(SDL_Renderer* renderer) {
+void Menu::renderTitle(RenderQueue& queue) {
     if (!titleFont) return;
     
     // Title with shadow
@@ -276,8 +325,8 @@ void Menu::renderTitle(SDL_Renderer* renderer) {
     
     // Shadow
     SDL_Color shadow = {0, 0, 0, static_cast<Uint8>(200 * fadeIn)};
-    renderText(renderer, "SUPER GAMW", windowWidth / 2 + 4, 
-            static_cast<int>(80 + bounce + 4), titleFont, shadow, true);
+    renderText(queue, MENU_LAYER_TITLE_SHADOW, "SUPER GAMW", windowWidth / 2 + 4, 
+            static_cast<int>(80 + bounce + 4), titleText, shadow, true);
     
     // Main title - Red color (Mario style)
     SDL_Color red = {
@@ -286,48 +335,43 @@ void Menu::renderTitle(SDL_Renderer* renderer) {
         static_cast<Uint8>(0),
         static_cast<Uint8>(255 * fadeIn)
     };
-    renderText(renderer, "SUPER GAMW", windowWidth / 2, 
-            static_cast<int>(80 + bounce), titleFont, red, true);
+    renderText(queue, MENU_LAYER_TITLE, "SUPER GAMW", windowWidth / 2, 
+            static_cast<int>(80 + bounce), titleText, red, true);
     
     // Subtitle
     if (itemFont) {
         SDL_Color yellow = {255, 220, 0, static_cast<Uint8>(255 * fadeIn)};
-        renderText(renderer, "BROS", windowWidth / 2, 
-                static_cast<int>(150 + bounce * 0.5f), itemFont, yellow, true);
+        renderText(queue, MENU_LAYER_TITLE, "BROS", windowWidth / 2, 
+                static_cast<int>(150 + bounce * 0.5f), itemText, yellow, true);
     }
 }
 
-void Menu::renderItems(SDL_Renderer* renderer) {
+void Menu::renderItems(RenderQueue& queue) {
     for (size_t i = 0; i < items.size(); i++) {
         bool isSelected = (i == static_cast<size_t>(selectedItem));
-        renderMenuItem(renderer, items[i], isSelected);
+        renderMenuItem(queue, i, isSelected);
     }
 }
 
-void Menu::renderMenuItem(SDL_Renderer* renderer, MenuItem& item, bool isSelected) {
+void Menu::renderMenuItem(RenderQueue& queue, size_t index, bool isSelected) {
+    MenuItem& item = items[index];
     SDL_Rect& r = item.rect;
-    float anim = easeInOutCubic(item.selectAnim);
+    int midY = r.y + r.h / 2;
     
-    // Box background - brick style
-    if (isSelected) {
-        // Orange/yellow brick (question block style)
-        SDL_SetRenderDrawColor(renderer, 243, 168, 59, static_cast<Uint8>(255 * fadeIn));
+    const ItemTextures* cached = index < itemTextures.size() ? &itemTextures[index] : nullptr;
+    if (cached && cached->normal && cached->selected) {
+        // Hanya alpha yang dihitung per frame: fade in dan transisi pilihan
+        float anim = easeInOutCubic(item.selectAnim);
+        SDL_Color normal = {255, 255, 255, static_cast<Uint8>(200 * fadeIn)};
+        queue.copy(MENU_LAYER_ITEM, cached->normal, nullptr, r, normal);
+        
+        if (anim > 0.01f) {
+            SDL_Color selected = {255, 255, 255, static_cast<Uint8>(255 * fadeIn * std::min(anim, 1.0f))};
+            queue.copy(MENU_LAYER_ITEM_TEXT, cached->selected, nullptr, r, selected);
+        }
     } else {
-        // Brown brick
-        SDL_SetRenderDrawColor(renderer, 184, 111, 80, static_cast<Uint8>(200 * fadeIn));
+        composeMenuItem(queue, MENU_LAYER_ITEM, item, r, isSelected, false);
     }
-    SDL_RenderFillRect(renderer, &r);
-    
-    // Brick outline
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, static_cast<Uint8>(255 * fadeIn));
-    SDL_RenderDrawRect(renderer, &r);
-    
-    // Inner brick details
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, static_cast<Uint8>(100 * fadeIn));
-    int midX = r.x + r.w / 2;
-    int midY = r.y + r.h / 2;
-    SDL_RenderDrawLine(renderer, r.x, midY, r.x + r.w, midY);
-    SDL_RenderDrawLine(renderer, midX, r.y, midX, r.y + r.h);
     
     // Selection indicator - Mario star
     if (isSelected) {
@@ -337,87 +381,75 @@ void Menu::renderMenuItem(SDL_Renderer* renderer, MenuItem& item, bool isSelecte
         // Left star
         int leftX = r.x - 35;
         int leftY = midY + static_cast<int>(starBounce);
-        renderMushroom(renderer, leftX, leftY - starSize);
+        renderMushroom(queue, leftX, leftY - starSize);
         
         // Right star
         int rightX = r.x + r.w + 20;
         int rightY = midY + static_cast<int>(starBounce);
-        renderMushroom(renderer, rightX, rightY - starSize);
+        renderMushroom(queue, rightX, rightY - starSize);
+    }
+}
+
+// Kotak bata + teks item di rect r, memakai layer s.d. layer + 2.
+// baked: untuk cache texture - warna penuh, alpha diterapkan saat copy.
+void Menu::composeMenuItem(RenderQueue& queue, int layer, const MenuItem& item, const SDL_Rect& r,
+                           bool isSelected, bool baked) {
+    float fade = baked ? 1.0f : fadeIn;
+    
+    // Box background - brick style
+    SDL_Color boxColor;
+    if (isSelected) {
+        // Orange/yellow brick (question block style)
+        boxColor = {243, 168, 59, static_cast<Uint8>(255 * fade)};
+    } else {
+        // Brown brick
+        boxColor = {184, 111, 80, static_cast<Uint8>((baked ? 255 : 200) * fade)};
     }
+    queue.fillRect(layer, r, boxColor);
+    
+    // Brick outline
+    queue.drawRect(layer + 1, r, SDL_Color{0, 0, 0, static_cast<Uint8>(255 * fade)});
+    
+    // Inner brick details
+    SDL_Color detail = {0, 0, 0, static_cast<Uint8>(100 * fade)};
+    int midX = r.x + r.w / 2;
+    int midY = r.y + r.h / 2;
+    queue.drawLine(layer + 1, r.x, midY, r.x + r.w, midY, detail);
+    queue.drawLine(layer + 1, midX, r.y, midX, r.y + r.h, detail);
     
     // Render text
     if (itemFont) {
         SDL_Color textColor;
         if (isSelected) {
-            textColor = {255, 255, 255, static_cast<Uint8>(255 * fadeIn)};
+            textColor = {255, 255, 255, static_cast<Uint8>(255 * fade)};
         } else {
-            textColor = {240, 230, 200, static_cast<Uint8>(230 * fadeIn)};
+            textColor = {240, 230, 200, static_cast<Uint8>((baked ? 255 : 230) * fade)};
         }
         
-        renderText(renderer, item.text.c_str(), midX, 
-                midY - 14, itemFont, textColor, true);
+        renderText(queue, layer + 2, item.text.c_str(), midX, 
+                midY - 14, itemText, textColor, true);
     }
 }
 
-void Menu::renderCoin(SDL_Renderer* renderer, int x, int y, float rotation) {
-    // Simple coin (yellow circle approximation)
+void Menu::renderCoin(RenderQueue& queue, int x, int y, float rotation) {
+    // Coin dari atlas sprite; frame = lebar coin yang sedang berputar
     int size = 20;
     float scale = std::abs(std::cos(rotation));
     int width = static_cast<int>(size * scale);
     
-    // Outer circle
-    SDL_SetRenderDrawColor(renderer, 255, 200, 0, static_cast<Uint8>(255 * fadeIn));
-    SDL_Rect coin = {x - width / 2, y - size / 2, width, size};
-    SDL_RenderFillRect(renderer, &coin);
-    
-    // Inner detail
-    if (scale > 0.3f) {
-        SDL_SetRenderDrawColor(renderer, 200, 150, 0, static_cast<Uint8>(255 * fadeIn));
-        int innerWidth = static_cast<int>(width * 0.6f);
-        SDL_Rect inner = {x - innerWidth / 2, y - size / 3, innerWidth, size * 2 / 3};
-        SDL_RenderFillRect(renderer, &inner);
-    }
+    SDL_Color alpha = {255, 255, 255, static_cast<Uint8>(255 * fadeIn)};
+    sprites.draw(queue, MENU_LAYER_COIN, SPRITE_MENU_COIN, width, x, y, alpha);
 }
 
-void Menu::renderMushroom(SDL_Renderer* renderer, int x, int y) {
+void Menu::renderMushroom(RenderQueue& queue, int x, int y) {
     // Simple mushroom (Mario power-up style)
-    int size = 24;
-    
-    // Stem (beige)
-    SDL_SetRenderDrawColor(renderer, 240, 220, 180, static_cast<Uint8>(255 * fadeIn));
-    SDL_Rect stem = {x - size / 4, y + size / 2, size / 2, size / 2};
-    SDL_RenderFillRect(renderer, &stem);
-    
-    // Cap (red with white spots)
-    SDL_SetRenderDrawColor(renderer, 255, 40, 40, static_cast<Uint8>(255 * fadeIn));
-    SDL_Rect cap = {x - size / 2, y, size, size / 2};
-    SDL_RenderFillRect(renderer, &cap);
-    
-    // White spots
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, static_cast<Uint8>(255 * fadeIn));
-    SDL_Rect spot1 = {x - size / 3, y + 4, 6, 6};
-    SDL_Rect spot2 = {x + size / 6, y + 4, 6, 6};
-    SDL_RenderFillRect(renderer, &spot1);
-    SDL_RenderFillRect(renderer, &spot2);
+    SDL_Color alpha = {255, 255, 255, static_cast<Uint8>(255 * fadeIn)};
+    sprites.draw(queue, MENU_LAYER_ITEM, SPRITE_MUSHROOM, 0, x, y, alpha);
 }
 
-void Menu::renderText(SDL_Renderer* renderer, const char* text, int x, int y, 
-                    TTF_Font* font, SDL_Color color, bool centered) {
-    if (!font) return;
-    
-    SDL_Surface* surface = TTF_RenderText_Solid(font, text, color);
-    if (surface) {
-        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-        SDL_Rect rect = {
-            centered ? x - surface->w / 2 : x,
-            y,
-            surface->w,
-            surface->h
-        };
-        SDL_RenderCopy(renderer, texture, nullptr, &rect);
-        SDL_DestroyTexture(texture);
-        SDL_FreeSurface(surface);
-    }
+void Menu::renderText(RenderQueue& queue, int layer, const char* text, int x, int y, 
+                    GlyphAtlas& atlas, SDL_Color color, bool centered) {
+    atlas.draw(queue, layer, text, x, y, color, centered);
 }
 
 float Menu::easeInOutCubic(float t) {
@@ -433,7 +465,126 @@ SDL_Color Menu::lerpColor(SDL_Color a, SDL_Color b, float t) {
     };
 }
 
-void Menu::cleanup() {
+// ========================================
+// Cache texture
+// ========================================
+
+void Menu::buildCaches(SDL_Renderer* renderer) {
+    releaseCaches();
+    cacheRenderer = renderer;
+    cacheWidth = windowWidth;
+    cacheHeight = windowHeight;
+    if (!renderer) return;
+    
+    // Langit: lebar 1 pixel, satu warna gradasi per baris
+    int skyHeight = windowHeight - GROUND_HEIGHT;
+    SDL_Surface* sky = skyHeight > 0
+        ? SDL_CreateRGBSurfaceWithFormat(0, 1, skyHeight, 32, SDL_PIXELFORMAT_ARGB8888) : nullptr;
+    if (sky) {
+        for (int y = 0; y < skyHeight; y++) {
+            SDL_Color c = lerpColor(SKY_TOP, SKY_BOTTOM, static_cast<float>(y) / skyHeight);
+            SDL_Rect row = {0, y, 1, 1};
+            SDL_FillRect(sky, &row, SDL_MapRGBA(sky->format, c.r, c.g, c.b, 255));
+        }
+        skyTexture = SDL_CreateTextureFromSurface(renderer, sky);
+        registerSoftwareImage(skyTexture, sky);
+        SDL_FreeSurface(sky);
+    }
+    
+    // Tanah + rumput; bagian atas rumput transparan
+    SDL_Surface* ground = SDL_CreateRGBSurfaceWithFormat(0, windowWidth, GROUND_HEIGHT + BLADE_HEIGHT, 32,
+                                                         SDL_PIXELFORMAT_ARGB8888);
+    if (ground) {
+        Uint32 grass = SDL_MapRGBA(ground->format, GRASS_COLOR.r, GRASS_COLOR.g, GRASS_COLOR.b, 255);
+        Uint32 dirt = SDL_MapRGBA(ground->format, DIRT_COLOR.r, DIRT_COLOR.g, DIRT_COLOR.b, 255);
+        Uint32 blade = SDL_MapRGBA(ground->format, BLADE_COLOR.r, BLADE_COLOR.g, BLADE_COLOR.b, 255);
+        
+        SDL_FillRect(ground, nullptr, 0);
+        SDL_Rect grassRect = {0, BLADE_HEIGHT, windowWidth, GROUND_HEIGHT};
+        SDL_FillRect(ground, &grassRect, grass);
+        SDL_Rect dirtRect = {0, BLADE_HEIGHT + 40, windowWidth, 60};
+        SDL_FillRect(ground, &dirtRect, dirt);
+        for (int x = 0; x < windowWidth; x += 20) {
+            SDL_Rect shortBlade = {x, BLADE_HEIGHT - 8, 1, 9};
+            SDL_Rect tallBlade = {x + 10, 0, 1, BLADE_HEIGHT + 1};
+            SDL_FillRect(ground, &shortBlade, blade);
+            SDL_FillRect(ground, &tallBlade, blade);
+        }
+        
+        groundTexture = SDL_CreateTextureFromSurface(renderer, ground);
+        if (groundTexture) SDL_SetTextureBlendMode(groundTexture, SDL_BLENDMODE_BLEND);
+        registerSoftwareImage(groundTexture, ground);
+        SDL_FreeSurface(ground);
+    }
+    
+    // Item normal dan terpilih: perlu render target karena teks dari atlas glyph
+    // (backend software menggambar item langsung)
+    itemTextures.assign(items.size(), ItemTextures{nullptr, nullptr});
+    if (SDL_RenderTargetSupported(renderer) != SDL_TRUE || softwareRendering) return;
+    
+    cacheQueue.init(renderer);
+    SDL_Texture* previous = SDL_GetRenderTarget(renderer);
+    for (size_t i = 0; i < items.size(); i++) {
+        const SDL_Rect& r = items[i].rect;
+        SDL_Rect local = {0, 0, r.w, r.h};
+        
+        for (int selected = 0; selected < 2; selected++) {
+            SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                                     SDL_TEXTUREACCESS_TARGET, r.w, r.h);
+            if (!texture) break;
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+            
+            SDL_SetRenderTarget(renderer, texture);
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+            SDL_RenderClear(renderer);
+            composeMenuItem(cacheQueue, 0, items[i], local, selected != 0, true);
+            cacheQueue.flush();
+            
+            if (selected) itemTextures[i].selected = texture;
+            else itemTextures[i].normal = texture;
+        }
+    }
+    SDL_SetRenderTarget(renderer, previous);
+}
+
+void Menu::releaseCaches() {
+    if (skyTexture) {
+        releaseSoftwareImage(skyTexture);
+        SDL_DestroyTexture(skyTexture);
+        skyTexture = nullptr;
+    }
+    if (groundTexture) {
+        releaseSoftwareImage(groundTexture);
+        SDL_DestroyTexture(groundTexture);
+        groundTexture = nullptr;
+    }
+    for (auto& cached : itemTextures) {
+        if (cached.normal) SDL_DestroyTexture(cached.normal);
+        if (cached.selected) SDL_DestroyTexture(cached.selected);
+    }
+    itemTextures.clear();
+    cacheQueue.clear();
+    cacheRenderer = nullptr;
+    cacheWidth = 0;
+    cacheHeight = 0;
+}
+
+void Menu::invalidateCache() {
+    // Dibangun ulang di render berikutnya
+    cacheWidth = 0;
+    cacheHeight = 0;
+    titleText.release();
+    itemText.release();
+    smallText.release();
+    sprites.release();
+}
+
+void Menu::closeFonts() {
+    // Texture atlas dilepas sebelum font dan renderer
+    titleText.init(nullptr);
+    itemText.init(nullptr);
+    smallText.init(nullptr);
+    
     if (titleFont) {
         TTF_CloseFont(titleFont);
         titleFont = nullptr;
@@ -447,3 +598,9 @@ void Menu::cleanup() {
         smallFont = nullptr;
     }
 }
+
+void Menu::cleanup() {
+    releaseCaches();
+    sprites.release();
+    closeFonts();
+}
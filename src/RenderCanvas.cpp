@@ -0,0 +1,127 @@
+#include "RenderCanvas.h"
+#include <algorithm>
+
+RenderCanvas::RenderCanvas()
+    : renderer(nullptr), target(nullptr), scaleMode(CANVAS_NATIVE),
+      logicalWidth(0), logicalHeight(0), useSoftware(false) {
+}
+
+RenderCanvas::~RenderCanvas() {
+    release();
+}
+
+void RenderCanvas::release() {
+    if (target) {
+        SDL_DestroyTexture(target);
+        target = nullptr;
+    }
+    framebuffer.release();
+    useSoftware = false;
+}
+
+bool RenderCanvas::init(SDL_Renderer* r, CanvasScale mode) {
+    release();
+    renderer = r;
+    scaleMode = mode;
+    if (!renderer) return false;
+
+    if (softwareRendering) {
+        // Native: framebuffer seukuran output, tetap satu upload per frame
+        logicalWidth = LOGICAL_WIDTH;
+        logicalHeight = LOGICAL_HEIGHT;
+        if (scaleMode == CANVAS_NATIVE) SDL_GetRendererOutputSize(renderer, &logicalWidth, &logicalHeight);
+        useSoftware = framebuffer.init(renderer, logicalWidth, logicalHeight);
+        if (useSoftware) return true;
+    }
+
+    if (scaleMode != CANVAS_NATIVE && SDL_RenderTargetSupported(renderer) == SDL_TRUE) {
+        target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                   LOGICAL_WIDTH, LOGICAL_HEIGHT);
+        // Copy akhir menimpa seluruh area, tidak perlu blending
+        if (target) SDL_SetTextureBlendMode(target, SDL_BLENDMODE_NONE);
+    }
+
+    if (target) {
+        logicalWidth = LOGICAL_WIDTH;
+        logicalHeight = LOGICAL_HEIGHT;
+    } else {
+        scaleMode = CANVAS_NATIVE;
+        SDL_GetRendererOutputSize(renderer, &logicalWidth, &logicalHeight);
+    }
+    return true;
+}
+
+SDL_Rect RenderCanvas::outputRect() const {
+    int outputWidth, outputHeight;
+    SDL_GetRendererOutputSize(renderer, &outputWidth, &outputHeight);
+    if (scaleMode == CANVAS_NATIVE) return SDL_Rect{0, 0, outputWidth, outputHeight};
+
+    int w, h;
+    int scale = std::min(outputWidth / logicalWidth, outputHeight / logicalHeight);
+    if (scaleMode == CANVAS_INTEGER && scale >= 1) {
+        w = logicalWidth * scale;
+        h = logicalHeight * scale;
+    } else {
+        // Fit (juga untuk integer kalau output lebih kecil dari canvas)
+        float fit = std::min(static_cast<float>(outputWidth) / logicalWidth,
+                             static_cast<float>(outputHeight) / logicalHeight);
+        w = static_cast<int>(logicalWidth * fit);
+        h = static_cast<int>(logicalHeight * fit);
+    }
+    return SDL_Rect{(outputWidth - w) / 2, (outputHeight - h) / 2, w, h};
+}
+
+void RenderCanvas::begin() {
+    if (useSoftware) framebuffer.begin();
+    else if (target) SDL_SetRenderTarget(renderer, target);
+}
+
+void RenderCanvas::clear(SDL_Color color) {
+    if (useSoftware) {
+        framebuffer.clear(color);
+    } else {
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+        SDL_RenderClear(renderer);
+    }
+}
+
+void RenderCanvas::present() {
+    if (useSoftware) {
+        framebuffer.end();
+
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        SDL_RenderClear(renderer);
+
+        SDL_Rect dst = outputRect();
+        SDL_RenderCopy(renderer, framebuffer.texture(), nullptr, &dst);
+    } else if (target) {
+        SDL_SetRenderTarget(renderer, nullptr);
+
+        // Letterbox
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        SDL_RenderClear(renderer);
+
+        SDL_Rect dst = outputRect();
+        SDL_RenderCopy(renderer, target, nullptr, &dst);
+    }
+    SDL_RenderPresent(renderer);
+}
+
+SDL_Point RenderCanvas::toLogical(int x, int y) const {
+    // HighDPI: event dalam point window, output renderer dalam pixel
+    int windowWidth = 0, windowHeight = 0;
+    int outputWidth = 0, outputHeight = 0;
+    SDL_Window* window = renderer ? SDL_RenderGetWindow(renderer) : nullptr;
+    if (window) SDL_GetWindowSize(window, &windowWidth, &windowHeight);
+    if (renderer) SDL_GetRendererOutputSize(renderer, &outputWidth, &outputHeight);
+
+    if (windowWidth > 0 && windowHeight > 0) {
+        x = x * outputWidth / windowWidth;
+        y = y * outputHeight / windowHeight;
+    }
+    if (scaleMode == CANVAS_NATIVE) return SDL_Point{x, y};
+
+    SDL_Rect dst = outputRect();
+    if (dst.w <= 0 || dst.h <= 0) return SDL_Point{0, 0};
+    return SDL_Point{(x - dst.x) * logicalWidth / dst.w, (y - dst.y) * logicalHeight / dst.h};
+}
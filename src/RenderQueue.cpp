@@ -0,0 +1,254 @@
+#include "RenderQueue.h"
+#include "SoftwareFramebuffer.h"
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+
+// SDL_RenderGeometry ada sejak SDL 2.0.18
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+#define RENDERQUEUE_HAS_GEOMETRY 1
+#else
+#define RENDERQUEUE_HAS_GEOMETRY 0
+#endif
+
+RenderQueue::RenderQueue()
+    : target(nullptr), software(nullptr), hasColor(false), currentColor(0) {
+    frameStats = {0, 0, 0};
+    lastStats = frameStats;
+}
+
+RenderQueue::~RenderQueue() {
+    clear();
+}
+
+bool RenderQueue::init(SDL_Renderer* renderer) {
+    clear();
+    target = renderer;
+    return target != nullptr;
+}
+
+void RenderQueue::clear() {
+    for (SDL_Texture* texture : ownedTextures) SDL_DestroyTexture(texture);
+    ownedTextures.clear();
+    commands.clear();
+}
+
+void RenderQueue::push(int layer, Kind kind, SDL_Texture* texture, Uint32 color, Uint32 color2,
+                       const SDL_Rect* src, const SDL_Rect& rect) {
+    Command c;
+    c.layer = layer;
+    c.kind = kind;
+    c.texture = texture;
+    c.color = color;
+    c.color2 = color2;
+    c.src = src ? *src : SDL_Rect{0, 0, 0, 0};
+    c.rect = rect;
+    c.order = static_cast<unsigned>(commands.size());
+    commands.push_back(c);
+}
+
+void RenderQueue::fillRect(int layer, const SDL_Rect& rect, SDL_Color color) {
+    if (rect.w <= 0 || rect.h <= 0) return;
+    push(layer, KIND_FILL, nullptr, packColor(color), 0, nullptr, rect);
+}
+
+void RenderQueue::drawRect(int layer, const SDL_Rect& r, SDL_Color color) {
+    if (r.w <= 0 || r.h <= 0) return;
+
+    // Empat sisi sebagai rect 1 pixel, supaya ikut batch fill
+    fillRect(layer, SDL_Rect{r.x, r.y, r.w, 1}, color);
+    if (r.h > 1) fillRect(layer, SDL_Rect{r.x, r.y + r.h - 1, r.w, 1}, color);
+    if (r.h > 2) {
+        fillRect(layer, SDL_Rect{r.x, r.y + 1, 1, r.h - 2}, color);
+        if (r.w > 1) fillRect(layer, SDL_Rect{r.x + r.w - 1, r.y + 1, 1, r.h - 2}, color);
+    }
+}
+
+void RenderQueue::drawLine(int layer, int x0, int y0, int x1, int y1, SDL_Color color) {
+    if (y0 == y1) {
+        fillRect(layer, SDL_Rect{std::min(x0, x1), y0, std::abs(x1 - x0) + 1, 1}, color);
+    } else if (x0 == x1) {
+        fillRect(layer, SDL_Rect{x0, std::min(y0, y1), 1, std::abs(y1 - y0) + 1}, color);
+    } else {
+        // rect menyimpan titik ujung (x0, y0) - (x1, y1)
+        push(layer, KIND_LINE, nullptr, packColor(color), 0, nullptr, SDL_Rect{x0, y0, x1, y1});
+    }
+}
+
+void RenderQueue::fillGradient(int layer, const SDL_Rect& rect, SDL_Color top, SDL_Color bottom) {
+    if (rect.w <= 0 || rect.h <= 0) return;
+    push(layer, KIND_GEOMETRY, nullptr, packColor(top), packColor(bottom), nullptr, rect);
+}
+
+void RenderQueue::copy(int layer, SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect& dst,
+                       SDL_Color modulate, bool ownTexture) {
+    if (!texture) return;
+    if (ownTexture) ownedTextures.push_back(texture);
+    Uint32 color = packColor(modulate);
+    push(layer, KIND_GEOMETRY, texture, color, color, src, dst);
+}
+
+// ========================================
+// Flush
+// ========================================
+
+void RenderQueue::setColor(Uint32 color) {
+    if (hasColor && color == currentColor) return;
+
+    SDL_Color c = unpackColor(color);
+    SDL_SetRenderDrawColor(target, c.r, c.g, c.b, c.a);
+    hasColor = true;
+    currentColor = color;
+    frameStats.stateChanges++;
+}
+
+void RenderQueue::submitFills(size_t begin, size_t end) {
+    setColor(commands[sorted[begin]].color);
+
+    rectBatch.clear();
+    for (size_t i = begin; i < end; i++) rectBatch.push_back(commands[sorted[i]].rect);
+    SDL_RenderFillRects(target, rectBatch.data(), static_cast<int>(rectBatch.size()));
+    frameStats.drawCalls++;
+}
+
+void RenderQueue::submitLines(size_t begin, size_t end) {
+    setColor(commands[sorted[begin]].color);
+
+    for (size_t i = begin; i < end; i++) {
+        const SDL_Rect& r = commands[sorted[i]].rect;
+        SDL_RenderDrawLine(target, r.x, r.y, r.w, r.h);
+        frameStats.drawCalls++;
+    }
+}
+
+void RenderQueue::submitGeometry(size_t begin, size_t end) {
+    SDL_Texture* texture = commands[sorted[begin]].texture;
+    int textureW = 1;
+    int textureH = 1;
+    if (texture) SDL_QueryTexture(texture, nullptr, nullptr, &textureW, &textureH);
+
+#if RENDERQUEUE_HAS_GEOMETRY
+    vertexBatch.clear();
+    indexBatch.clear();
+
+    for (size_t i = begin; i < end; i++) {
+        const Command& c = commands[sorted[i]];
+        SDL_Rect src = c.src.w > 0 ? c.src : SDL_Rect{0, 0, textureW, textureH};
+
+        float x0 = static_cast<float>(c.rect.x);
+        float y0 = static_cast<float>(c.rect.y);
+        float x1 = static_cast<float>(c.rect.x + c.rect.w);
+        float y1 = static_cast<float>(c.rect.y + c.rect.h);
+        float u0 = static_cast<float>(src.x) / textureW;
+        float v0 = static_cast<float>(src.y) / textureH;
+        float u1 = static_cast<float>(src.x + src.w) / textureW;
+        float v1 = static_cast<float>(src.y + src.h) / textureH;
+        SDL_Color top = unpackColor(c.color);
+        SDL_Color bottom = unpackColor(c.color2);
+
+        int base = static_cast<int>(vertexBatch.size());
+        vertexBatch.push_back(SDL_Vertex{SDL_FPoint{x0, y0}, top, SDL_FPoint{u0, v0}});
+        vertexBatch.push_back(SDL_Vertex{SDL_FPoint{x1, y0}, top, SDL_FPoint{u1, v0}});
+        vertexBatch.push_back(SDL_Vertex{SDL_FPoint{x1, y1}, bottom, SDL_FPoint{u1, v1}});
+        vertexBatch.push_back(SDL_Vertex{SDL_FPoint{x0, y1}, bottom, SDL_FPoint{u0, v1}});
+
+        const int quad[] = {0, 1, 2, 0, 2, 3};
+        for (int q : quad) indexBatch.push_back(base + q);
+    }
+
+    SDL_RenderGeometry(target, texture, vertexBatch.data(), static_cast<int>(vertexBatch.size()),
+                       indexBatch.data(), static_cast<int>(indexBatch.size()));
+    frameStats.drawCalls++;
+#else
+    // SDL lama: satu copy per quad, gradasi digambar per baris
+    Uint32 modulate = 0xFFFFFFFF;
+    for (size_t i = begin; i < end; i++) {
+        const Command& c = commands[sorted[i]];
+
+        if (texture) {
+            if (c.color != modulate) {
+                SDL_Color m = unpackColor(c.color);
+                SDL_SetTextureColorMod(texture, m.r, m.g, m.b);
+                SDL_SetTextureAlphaMod(texture, m.a);
+                modulate = c.color;
+                frameStats.stateChanges++;
+            }
+            SDL_RenderCopy(target, texture, c.src.w > 0 ? &c.src : nullptr, &c.rect);
+            frameStats.drawCalls++;
+        } else {
+            SDL_Color top = unpackColor(c.color);
+            SDL_Color bottom = unpackColor(c.color2);
+            for (int y = 0; y < c.rect.h; y++) {
+                float t = static_cast<float>(y) / c.rect.h;
+                SDL_Color row = {
+                    static_cast<Uint8>(top.r + (bottom.r - top.r) * t),
+                    static_cast<Uint8>(top.g + (bottom.g - top.g) * t),
+                    static_cast<Uint8>(top.b + (bottom.b - top.b) * t),
+                    static_cast<Uint8>(top.a + (bottom.a - top.a) * t)
+                };
+                setColor(packColor(row));
+                SDL_Rect line = {c.rect.x, c.rect.y + y, c.rect.w, 1};
+                SDL_RenderFillRect(target, &line);
+                frameStats.drawCalls++;
+            }
+        }
+    }
+    if (texture && modulate != 0xFFFFFFFF) {
+        SDL_SetTextureColorMod(texture, 255, 255, 255);
+        SDL_SetTextureAlphaMod(texture, 255);
+    }
+#endif
+}
+
+void RenderQueue::flush() {
+    frameStats.commands = static_cast<int>(commands.size());
+
+    if ((target || software) && !commands.empty()) {
+        sorted.resize(commands.size());
+        for (size_t i = 0; i < sorted.size(); i++) sorted[i] = static_cast<unsigned>(i);
+
+        const std::vector<Command>& cmds = commands;
+        std::sort(sorted.begin(), sorted.end(), [&cmds](unsigned ia, unsigned ib) {
+            const Command& a = cmds[ia];
+            const Command& b = cmds[ib];
+            if (a.layer != b.layer) return a.layer < b.layer;
+            if (a.kind != b.kind) return a.kind < b.kind;
+            if (a.texture != b.texture) return std::less<SDL_Texture*>()(a.texture, b.texture);
+            if (a.kind != KIND_GEOMETRY && a.color != b.color) return a.color < b.color;
+            return a.order < b.order;
+        });
+    }
+
+    if (software && !commands.empty()) {
+        // Rasterize di CPU, urutan sama dengan jalur SDL
+        software->draw(commands, sorted);
+        frameStats.drawCalls++;
+    } else if (target && !commands.empty()) {
+        // Warna renderer bisa diubah kode lain di antara frame
+        hasColor = false;
+
+        // Run = item berurutan dengan state sama; boleh lintas layer
+        size_t begin = 0;
+        while (begin < sorted.size()) {
+            const Command& first = commands[sorted[begin]];
+            size_t end = begin + 1;
+            while (end < sorted.size()) {
+                const Command& c = commands[sorted[end]];
+                if (c.kind != first.kind) break;
+                if (first.kind == KIND_GEOMETRY ? c.texture != first.texture : c.color != first.color) break;
+                end++;
+            }
+
+            switch (first.kind) {
+                case KIND_FILL: submitFills(begin, end); break;
+                case KIND_GEOMETRY: submitGeometry(begin, end); break;
+                case KIND_LINE: submitLines(begin, end); break;
+            }
+            begin = end;
+        }
+    }
+
+    clear();
+    lastStats = frameStats;
+    frameStats = {0, 0, 0};
+}
@@ -0,0 +1,370 @@
+#include "SoftwareFramebuffer.h"
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_map>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SOFTWARE_HAS_SSE2 1
+#else
+#define SOFTWARE_HAS_SSE2 0
+#endif
+
+bool softwareRendering = false;
+
+struct SoftwareImage {
+    int w;
+    int h;
+    std::vector<Uint32> pixels;     // ARGB8888
+};
+
+namespace {
+
+std::unordered_map<SDL_Texture*, SoftwareImage*>& images() {
+    static std::unordered_map<SDL_Texture*, SoftwareImage*> registry;
+    return registry;
+}
+
+// x * y / 255 dibulatkan ke bawah, tanpa pembagian (tepat untuk x * y <= 65535)
+inline unsigned mul255(unsigned x, unsigned y) {
+    unsigned p = x * y;
+    return (p + 1 + (p >> 8)) >> 8;
+}
+
+inline Uint32 packPixel(unsigned r, unsigned g, unsigned b, unsigned a) {
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+// Rumus blend fill renderer software SDL (SDL_BlendFillRect):
+// src di-premultiply sekali, lalu dst = src + dst * (255 - a) / 255
+void blendSpan(Uint32* row, int count, unsigned r, unsigned g, unsigned b, unsigned a) {
+    if (a == 0) return;
+    if (a == 255) {
+        std::fill(row, row + count, packPixel(r, g, b, 255));
+        return;
+    }
+
+    unsigned pr = mul255(r, a);
+    unsigned pg = mul255(g, a);
+    unsigned pb = mul255(b, a);
+    unsigned inva = 255 - a;
+    int i = 0;
+
+#if SOFTWARE_HAS_SSE2
+    // 4 pixel per iterasi, channel 16 bit (urutan byte memory: B G R A)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i inv = _mm_set1_epi16(static_cast<short>(inva));
+    const __m128i src = _mm_set_epi16(static_cast<short>(a), static_cast<short>(pr), static_cast<short>(pg), static_cast<short>(pb),
+                                      static_cast<short>(a), static_cast<short>(pr), static_cast<short>(pg), static_cast<short>(pb));
+    for (; i + 4 <= count; i += 4) {
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+        __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv);
+        __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv);
+        lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo, one), _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi, one), _mm_srli_epi16(hi, 8)), 8);
+        lo = _mm_add_epi16(lo, src);
+        hi = _mm_add_epi16(hi, src);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(row + i), _mm_packus_epi16(lo, hi));
+    }
+#endif
+
+    for (; i < count; i++) {
+        Uint32 d = row[i];
+        row[i] = packPixel(pr + mul255(inva, (d >> 16) & 0xFF),
+                           pg + mul255(inva, (d >> 8) & 0xFF),
+                           pb + mul255(inva, d & 0xFF),
+                           a + mul255(inva, d >> 24));
+    }
+}
+
+// Rumus blit SDL untuk copy dengan color/alpha mod dan blend (SDL_blit_auto)
+inline Uint32 blendTexel(Uint32 s, Uint32 d, unsigned modR, unsigned modG, unsigned modB, unsigned modA) {
+    unsigned srcA = mul255(s >> 24, modA);
+    if (srcA == 0) return d;
+
+    unsigned srcR = mul255((s >> 16) & 0xFF, modR);
+    unsigned srcG = mul255((s >> 8) & 0xFF, modG);
+    unsigned srcB = mul255(s & 0xFF, modB);
+    if (srcA < 255) {
+        srcR = mul255(srcR, srcA);
+        srcG = mul255(srcG, srcA);
+        srcB = mul255(srcB, srcA);
+    }
+
+    unsigned inva = 255 - srcA;
+    return packPixel(srcR + mul255(inva, (d >> 16) & 0xFF),
+                     srcG + mul255(inva, (d >> 8) & 0xFF),
+                     srcB + mul255(inva, d & 0xFF),
+                     srcA + mul255(inva, d >> 24));
+}
+
+}
+
+void registerSoftwareImage(SDL_Texture* texture, SDL_Surface* surface) {
+    if (!softwareRendering || !texture || !surface) return;
+
+    SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+    if (!converted) return;
+
+    SoftwareImage* image = new SoftwareImage();
+    image->w = converted->w;
+    image->h = converted->h;
+    image->pixels.resize(static_cast<size_t>(image->w) * image->h);
+
+    SDL_LockSurface(converted);
+    for (int y = 0; y < image->h; y++) {
+        const Uint32* src = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(converted->pixels) + y * converted->pitch);
+        std::copy(src, src + image->w, image->pixels.begin() + static_cast<size_t>(y) * image->w);
+    }
+    SDL_UnlockSurface(converted);
+    SDL_FreeSurface(converted);
+
+    releaseSoftwareImage(texture);
+    images()[texture] = image;
+}
+
+void releaseSoftwareImage(SDL_Texture* texture) {
+    auto found = images().find(texture);
+    if (found == images().end()) return;
+    delete found->second;
+    images().erase(found);
+}
+
+// ========================================
+// Framebuffer
+// ========================================
+
+SoftwareFramebuffer::SoftwareFramebuffer()
+    : streaming(nullptr), frameWidth(0), frameHeight(0), pixels(nullptr), pitch(0), locked(false),
+      clearColor{0, 0, 0, 255}, clearPending(false), bandCount(0), bandHeight(0),
+      generation(0), activeWorkers(0), stopping(false), nextBand(0) {
+}
+
+SoftwareFramebuffer::~SoftwareFramebuffer() {
+    release();
+}
+
+void SoftwareFramebuffer::release() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) worker.join();
+    workers.clear();
+    stopping = false;
+
+    if (streaming) {
+        if (locked) SDL_UnlockTexture(streaming);
+        SDL_DestroyTexture(streaming);
+        streaming = nullptr;
+    }
+    locked = false;
+    pixels = nullptr;
+    backBuffer.clear();
+}
+
+bool SoftwareFramebuffer::init(SDL_Renderer* renderer, int width, int height, int threads) {
+    release();
+    if (!renderer || width <= 0 || height <= 0) return false;
+
+    streaming = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, width, height);
+    if (!streaming) return false;
+    SDL_SetTextureBlendMode(streaming, SDL_BLENDMODE_NONE);
+
+    frameWidth = width;
+    frameHeight = height;
+    backBuffer.assign(static_cast<size_t>(width) * height, 0);
+
+    if (threads <= 0) threads = static_cast<int>(std::thread::hardware_concurrency());
+    threads = std::max(1, std::min(threads, 16));
+    for (int i = 1; i < threads; i++) workers.emplace_back(&SoftwareFramebuffer::workerLoop, this);
+
+    // Beberapa band per thread supaya beban rata walau isi layar tidak merata
+    bandHeight = std::max(16, (height + threads * 4 - 1) / (threads * 4));
+    bandCount = (height + bandHeight - 1) / bandHeight;
+    return true;
+}
+
+bool SoftwareFramebuffer::begin() {
+    if (!streaming) return false;
+
+    void* data = nullptr;
+    int bytes = 0;
+    if (!locked && SDL_LockTexture(streaming, nullptr, &data, &bytes) == 0) {
+        pixels = static_cast<Uint32*>(data);
+        pitch = bytes / static_cast<int>(sizeof(Uint32));
+        locked = true;
+    } else if (!locked) {
+        // Driver tanpa lock: gambar ke buffer sendiri lalu upload
+        pixels = backBuffer.data();
+        pitch = frameWidth;
+    }
+    return true;
+}
+
+void SoftwareFramebuffer::end() {
+    if (!pixels) return;
+
+    if (clearPending) {
+        items.clear();
+        runBands();
+    }
+
+    if (locked) {
+        SDL_UnlockTexture(streaming);
+        locked = false;
+    } else {
+        SDL_UpdateTexture(streaming, nullptr, backBuffer.data(), frameWidth * static_cast<int>(sizeof(Uint32)));
+    }
+    pixels = nullptr;
+}
+
+void SoftwareFramebuffer::clear(SDL_Color color) {
+    // Dikerjakan bersama band draw berikutnya
+    clearColor = color;
+    clearPending = true;
+}
+
+void SoftwareFramebuffer::draw(const std::vector<RenderQueue::Command>& commands, const std::vector<unsigned>& order) {
+    if (!pixels) return;
+
+    // Lookup image di thread utama; worker hanya membaca items
+    items.clear();
+    for (unsigned index : order) {
+        const RenderQueue::Command& c = commands[index];
+        DrawItem item = {&c, nullptr};
+        if (c.texture) {
+            auto found = images().find(c.texture);
+            if (found == images().end()) continue;     // Texture tanpa salinan CPU
+            item.image = found->second;
+        }
+        items.push_back(item);
+    }
+    runBands();
+}
+
+// ========================================
+// Thread pool
+// ========================================
+
+void SoftwareFramebuffer::workerLoop() {
+    unsigned seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this, seen] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+
+        renderBands();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--activeWorkers == 0) finished.notify_one();
+    }
+}
+
+void SoftwareFramebuffer::runBands() {
+    nextBand = 0;
+
+    if (!workers.empty()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        activeWorkers = static_cast<int>(workers.size());
+        generation++;
+    }
+    wake.notify_all();
+
+    // Thread utama ikut mengerjakan band
+    renderBands();
+
+    if (!workers.empty()) {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [this] { return activeWorkers == 0; });
+    }
+    clearPending = false;
+}
+
+void SoftwareFramebuffer::renderBands() {
+    int band;
+    while ((band = nextBand.fetch_add(1)) < bandCount) {
+        int y0 = band * bandHeight;
+        renderBand(y0, std::min(y0 + bandHeight, frameHeight));
+    }
+}
+
+// ========================================
+// Rasterizer
+// ========================================
+
+void SoftwareFramebuffer::renderBand(int y0, int y1) {
+    if (clearPending) {
+        Uint32 c = packPixel(clearColor.r, clearColor.g, clearColor.b, clearColor.a);
+        for (int y = y0; y < y1; y++) std::fill(pixels + y * pitch, pixels + y * pitch + frameWidth, c);
+    }
+
+    for (const DrawItem& item : items) {
+        const RenderQueue::Command& c = *item.command;
+        unsigned r = (c.color >> 24) & 0xFF;
+        unsigned g = (c.color >> 16) & 0xFF;
+        unsigned b = (c.color >> 8) & 0xFF;
+        unsigned a = c.color & 0xFF;
+
+        if (c.kind == RenderQueue::KIND_LINE) {
+            // Bresenham, hanya pixel di dalam band
+            int x = c.rect.x, y = c.rect.y;
+            int dx = std::abs(c.rect.w - x), sx = x < c.rect.w ? 1 : -1;
+            int dy = -std::abs(c.rect.h - y), sy = y < c.rect.h ? 1 : -1;
+            int err = dx + dy;
+            for (;;) {
+                if (y >= y0 && y < y1 && x >= 0 && x < frameWidth) blendSpan(pixels + y * pitch + x, 1, r, g, b, a);
+                if (x == c.rect.w && y == c.rect.h) break;
+                int e2 = 2 * err;
+                if (e2 >= dy) { err += dy; x += sx; }
+                if (e2 <= dx) { err += dx; y += sy; }
+            }
+            continue;
+        }
+
+        int x0 = std::max(c.rect.x, 0);
+        int x1 = std::min(c.rect.x + c.rect.w, frameWidth);
+        int rowStart = std::max(c.rect.y, y0);
+        int rowEnd = std::min(c.rect.y + c.rect.h, y1);
+        if (x0 >= x1 || rowStart >= rowEnd) continue;
+
+        if (c.kind == RenderQueue::KIND_FILL) {
+            for (int y = rowStart; y < rowEnd; y++) blendSpan(pixels + y * pitch + x0, x1 - x0, r, g, b, a);
+        } else if (!item.image) {
+            // Gradasi vertikal, satu warna per baris (sama dengan fallback RenderQueue)
+            unsigned r2 = (c.color2 >> 24) & 0xFF;
+            unsigned g2 = (c.color2 >> 16) & 0xFF;
+            unsigned b2 = (c.color2 >> 8) & 0xFF;
+            unsigned a2 = c.color2 & 0xFF;
+            for (int y = rowStart; y < rowEnd; y++) {
+                float t = static_cast<float>(y - c.rect.y) / c.rect.h;
+                blendSpan(pixels + y * pitch + x0, x1 - x0,
+                          static_cast<unsigned>(r + (static_cast<int>(r2) - static_cast<int>(r)) * t),
+                          static_cast<unsigned>(g + (static_cast<int>(g2) - static_cast<int>(g)) * t),
+                          static_cast<unsigned>(b + (static_cast<int>(b2) - static_cast<int>(b)) * t),
+                          static_cast<unsigned>(a + (static_cast<int>(a2) - static_cast<int>(a)) * t));
+            }
+        } else {
+            // Quad bertexture, nearest neighbor
+            const SoftwareImage& image = *item.image;
+            SDL_Rect src = c.src.w > 0 ? c.src : SDL_Rect{0, 0, image.w, image.h};
+            for (int y = rowStart; y < rowEnd; y++) {
+                int v = src.y + (y - c.rect.y) * src.h / c.rect.h;
+                if (v < 0 || v >= image.h) continue;
+                const Uint32* texels = image.pixels.data() + static_cast<size_t>(v) * image.w;
+                Uint32* row = pixels + y * pitch;
+
+                for (int x = x0; x < x1; x++) {
+                    int u = src.x + (x - c.rect.x) * src.w / c.rect.w;
+                    if (u < 0 || u >= image.w) continue;
+                    row[x] = blendTexel(texels[u], row[x], r, g, b, a);
+                }
+            }
+        }
+    }
+}
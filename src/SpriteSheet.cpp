@@ -0,0 +1,191 @@
+#include "SpriteSheet.h"
+#include "SoftwareFramebuffer.h"
+#include <algorithm>
+
+namespace {
+
+const int ATLAS_MAX_WIDTH = 256;
+const int SPRITE_PADDING = 1;
+
+}
+
+SpriteSheet::SpriteSheet() : texture(nullptr) {
+    for (int& first : firstFrame) first = 0;
+}
+
+SpriteSheet::~SpriteSheet() {
+    release();
+}
+
+void SpriteSheet::release() {
+    if (texture) {
+        releaseSoftwareImage(texture);
+        SDL_DestroyTexture(texture);
+        texture = nullptr;
+    }
+    frames.clear();
+}
+
+int SpriteSheet::frameCount(SpriteId id) {
+    switch (id) {
+        case SPRITE_PLAYER_RUN: return 7;
+        case SPRITE_COIN: return 13;
+        case SPRITE_MENU_COIN: return 21;
+        default: return 1;
+    }
+}
+
+// Bentuk sama dengan yang dulu digambar rect per rect di GameBox/Menu,
+// urut dari bawah ke atas
+void SpriteSheet::shape(SpriteId id, int frame, std::vector<Part>& parts) {
+    parts.clear();
+
+    switch (id) {
+        case SPRITE_PLAYER_RUN:
+        case SPRITE_PLAYER_JUMP: {
+            const SDL_Color legColor = {0, 0, 200, 255};
+            parts.push_back(Part{{4, 8, 24, 16}, {255, 0, 0, 255}});
+            if (id == SPRITE_PLAYER_RUN) {
+                int legOffset = frame - 3;
+                parts.push_back(Part{{8 + legOffset, 24, 6, 8}, legColor});
+                parts.push_back(Part{{18 - legOffset, 24, 6, 8}, legColor});
+            } else {
+                parts.push_back(Part{{10, 24, 12, 8}, legColor});
+            }
+            parts.push_back(Part{{8, 0, 16, 16}, {255, 200, 150, 255}});
+            parts.push_back(Part{{6, -4, 20, 8}, {200, 0, 0, 255}});
+            break;
+        }
+
+        case SPRITE_ENEMY:
+            parts.push_back(Part{{0, 0, 28, 28}, {139, 69, 19, 255}});
+            // Eyes
+            parts.push_back(Part{{6, 8, 6, 6}, {255, 255, 255, 255}});
+            parts.push_back(Part{{16, 8, 6, 6}, {255, 255, 255, 255}});
+            parts.push_back(Part{{8, 10, 3, 3}, {0, 0, 0, 255}});
+            parts.push_back(Part{{18, 10, 3, 3}, {0, 0, 0, 255}});
+            break;
+
+        case SPRITE_COIN: {
+            int width = frame + 4;
+            SDL_Rect r = {-width / 2, -8, width, 16};
+            const SDL_Color edge = {200, 160, 0, 255};
+            parts.push_back(Part{r, {255, 215, 0, 255}});
+            parts.push_back(Part{{r.x, r.y, r.w, 1}, edge});
+            parts.push_back(Part{{r.x, r.y + r.h - 1, r.w, 1}, edge});
+            parts.push_back(Part{{r.x, r.y + 1, 1, r.h - 2}, edge});
+            if (r.w > 1) parts.push_back(Part{{r.x + r.w - 1, r.y + 1, 1, r.h - 2}, edge});
+            break;
+        }
+
+        case SPRITE_MENU_COIN: {
+            int size = 20;
+            int width = frame;
+            if (width == 0) break;
+            parts.push_back(Part{{-width / 2, -size / 2, width, size}, {255, 200, 0, 255}});
+
+            // Inner detail (scale > 0.3)
+            if (width >= 6) {
+                int innerWidth = static_cast<int>(width * 0.6f);
+                parts.push_back(Part{{-innerWidth / 2, -size / 3, innerWidth, size * 2 / 3}, {200, 150, 0, 255}});
+            }
+            break;
+        }
+
+        case SPRITE_MUSHROOM: {
+            int size = 24;
+            parts.push_back(Part{{-size / 4, size / 2, size / 2, size / 2}, {240, 220, 180, 255}});
+            parts.push_back(Part{{-size / 2, 0, size, size / 2}, {255, 40, 40, 255}});
+            parts.push_back(Part{{-size / 3, 4, 6, 6}, {255, 255, 255, 255}});
+            parts.push_back(Part{{size / 6, 4, 6, 6}, {255, 255, 255, 255}});
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+bool SpriteSheet::init(SDL_Renderer* renderer) {
+    release();
+    if (!renderer) return false;
+
+    // Layout: bounding box tiap frame, shelf packing
+    std::vector<std::vector<Part>> shapes;
+    int x = SPRITE_PADDING;
+    int y = SPRITE_PADDING;
+    int rowHeight = 0;
+    int atlasWidth = 1;
+
+    for (int id = 0; id < SPRITE_COUNT; id++) {
+        firstFrame[id] = static_cast<int>(frames.size());
+
+        for (int f = 0; f < frameCount(static_cast<SpriteId>(id)); f++) {
+            shapes.emplace_back();
+            std::vector<Part>& parts = shapes.back();
+            shape(static_cast<SpriteId>(id), f, parts);
+
+            Frame frame = {{0, 0, 0, 0}, 0, 0};
+            if (!parts.empty()) {
+                int x0 = parts[0].rect.x, y0 = parts[0].rect.y;
+                int x1 = x0 + parts[0].rect.w, y1 = y0 + parts[0].rect.h;
+                for (const Part& part : parts) {
+                    x0 = std::min(x0, part.rect.x);
+                    y0 = std::min(y0, part.rect.y);
+                    x1 = std::max(x1, part.rect.x + part.rect.w);
+                    y1 = std::max(y1, part.rect.y + part.rect.h);
+                }
+                int w = x1 - x0;
+                int h = y1 - y0;
+
+                if (x + w + SPRITE_PADDING > ATLAS_MAX_WIDTH && x > SPRITE_PADDING) {
+                    x = SPRITE_PADDING;
+                    y += rowHeight + SPRITE_PADDING;
+                    rowHeight = 0;
+                }
+                frame = {{x, y, w, h}, x0, y0};
+                x += w + SPRITE_PADDING;
+                rowHeight = std::max(rowHeight, h);
+                atlasWidth = std::max(atlasWidth, x);
+            }
+            frames.push_back(frame);
+        }
+    }
+    int atlasHeight = y + rowHeight + SPRITE_PADDING;
+
+    // Bake di CPU, lalu upload sekali
+    SDL_Surface* atlas = SDL_CreateRGBSurfaceWithFormat(0, atlasWidth, atlasHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!atlas) return false;
+    SDL_FillRect(atlas, nullptr, 0);
+
+    for (size_t i = 0; i < frames.size(); i++) {
+        const Frame& frame = frames[i];
+        for (const Part& part : shapes[i]) {
+            SDL_Rect r = {
+                frame.src.x + part.rect.x - frame.offsetX,
+                frame.src.y + part.rect.y - frame.offsetY,
+                part.rect.w,
+                part.rect.h
+            };
+            SDL_FillRect(atlas, &r, SDL_MapRGBA(atlas->format, part.color.r, part.color.g, part.color.b, part.color.a));
+        }
+    }
+
+    texture = SDL_CreateTextureFromSurface(renderer, atlas);
+    if (texture) SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    registerSoftwareImage(texture, atlas);
+    SDL_FreeSurface(atlas);
+    return texture != nullptr;
+}
+
+void SpriteSheet::draw(RenderQueue& queue, int layer, SpriteId id, int frame, int x, int y,
+                       SDL_Color modulate) const {
+    if (!texture || frames.empty()) return;
+
+    frame = std::max(0, std::min(frame, frameCount(id) - 1));
+    const Frame& f = frames[firstFrame[id] + frame];
+    if (f.src.w == 0) return;
+
+    SDL_Rect dst = {x + f.offsetX, y + f.offsetY, f.src.w, f.src.h};
+    queue.copy(layer, texture, &f.src, dst, modulate);
+}
@@ -0,0 +1,107 @@
+#include "StageManager.h"
+#include <SDL2/SDL.h>
+
+StageManager::StageManager()
+    : width(0), pendingReady(false) {
+}
+
+StageManager::~StageManager() {
+    if (worker.joinable()) worker.join();
+}
+
+void StageManager::addStage(const std::string& name, const std::string& path, const LevelView& builtIn) {
+    StageInfo info;
+    info.name = name;
+    info.path = path;
+    info.builtIn = builtIn;
+    stages.push_back(info);
+}
+
+bool StageManager::prepare(int index, PreparedStage& out, std::string& error) const {
+    Uint64 start = SDL_GetPerformanceCounter();
+    const StageInfo& info = stages[index];
+    out.index = index;
+
+    std::string fileError = "no level file";
+    if (!info.path.empty() && out.file.open(info.path, fileError)) {
+        // Halaman file dibaca di sini, bukan saat chunk pertama dibangun
+        out.file.prefault();
+        out.level = out.file.view();
+    } else if (info.builtIn.valid()) {
+        out.level = info.builtIn;
+    } else {
+        error = info.name + ": " + fileError;
+        return false;
+    }
+
+    out.source.reset(new LevelChunkSource(out.level));
+    out.world.load(out.source.get(), streaming);
+    out.world.stream(0.0f, width);
+
+    out.prepareMs = (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+    return true;
+}
+
+bool StageManager::start(int first, int viewWidth, const StreamingConfig& config, std::string& error) {
+    finishPreload();
+    width = viewWidth;
+    streaming = config;
+
+    if (first < 0 || first >= stageCount()) {
+        error = "no such stage";
+        return false;
+    }
+
+    std::unique_ptr<PreparedStage> stage(new PreparedStage());
+    if (!prepare(first, *stage, error)) return false;
+
+    retired = std::move(active);
+    active = std::move(stage);
+    preload(first + 1);
+    return true;
+}
+
+bool StageManager::hasNext() const {
+    return active && active->index + 1 < stageCount();
+}
+
+void StageManager::preload(int index) {
+    pendingReady = false;
+    if (index >= stageCount()) {
+        // Tidak ada stage lagi, worker cukup melepas stage lama
+        if (retired) worker = std::thread([this]() { retired.reset(); });
+        return;
+    }
+
+    worker = std::thread([this, index]() {
+        retired.reset();
+
+        std::unique_ptr<PreparedStage> stage(new PreparedStage());
+        if (prepare(index, *stage, pendingError)) {
+            pending = std::move(stage);
+        }
+        pendingReady = true;
+    });
+}
+
+void StageManager::finishPreload() {
+    if (worker.joinable()) worker.join();
+}
+
+bool StageManager::advance(std::string& error) {
+    if (!hasNext()) {
+        error = "no next stage";
+        return false;
+    }
+
+    finishPreload();
+    if (!pending) {
+        error = pendingError;
+        return false;
+    }
+
+    retired = std::move(active);
+    active = std::move(pending);
+    preload(active->index + 1);
+    return true;
+}
@@ -0,0 +1,92 @@
+#include "TileMap.h"
+#include <algorithm>
+#include <cmath>
+
+TileMap::TileMap()
+    : numCols(0), numRows(0), size(32), numColliders(0),
+      tiles(nullptr), colliders(nullptr), colliderGrid(nullptr) {
+}
+
+void TileMap::attach(const LevelView& level) {
+    numCols = level.cols();
+    numRows = level.rows();
+    size = level.tileSize();
+    numColliders = level.colliderCount();
+    tiles = level.tiles;
+    colliders = level.colliders;
+    colliderGrid = level.colliderGrid;
+}
+
+Uint8 TileMap::tileAt(int col, int row) const {
+    if (!inBounds(col, row)) return TILE_EMPTY;
+    return tiles[row * numCols + col];
+}
+
+int TileMap::colliderAt(int col, int row) const {
+    if (!inBounds(col, row)) return -1;
+    Uint32 index = colliderGrid[row * numCols + col];
+    if (index == LEVEL_NO_COLLIDER || index >= static_cast<Uint32>(numColliders)) return -1;
+    return static_cast<int>(index);
+}
+
+SDL_Rect TileMap::colliderRect(int index) const {
+    const LevelCollider& c = colliders[index];
+    SDL_Rect r = {c.x, c.y, c.w, c.h};
+    return r;
+}
+
+void TileMap::collidersInArea(float x, float y, float w, float h, std::vector<int>& out) const {
+    out.clear();
+
+    int col0, col1, row0, row1;
+    if (!cellRange(x, y, w, h, col0, col1, row0, row1)) return;
+
+    for (int row = row0; row <= row1; row++) {
+        for (int col = col0; col <= col1; col++) {
+            int index = colliderAt(col, row);
+            if (index < 0) continue;
+
+            out.push_back(index);
+        }
+    }
+
+    // Collider hasil merge menempati banyak cell, cukup sekali
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+SDL_Rect TileMap::cellRect(int col, int row) const {
+    SDL_Rect r = {col * size, row * size, size, size};
+    return r;
+}
+
+bool TileMap::cellRange(float x, float y, float w, float h,
+                        int& col0, int& col1, int& row0, int& row1) const {
+    col0 = static_cast<int>(std::floor(x / size));
+    col1 = static_cast<int>(std::floor((x + w) / size));
+    row0 = static_cast<int>(std::floor(y / size));
+    row1 = static_cast<int>(std::floor((y + h) / size));
+
+    if (col0 < 0) col0 = 0;
+    if (row0 < 0) row0 = 0;
+    if (col1 > numCols - 1) col1 = numCols - 1;
+    if (row1 > numRows - 1) row1 = numRows - 1;
+
+    return col0 <= col1 && row0 <= row1;
+}
+
+void TileMap::columnRange(float x, float w, int& col0, int& col1) const {
+    col0 = static_cast<int>(std::floor(x / size));
+    col1 = static_cast<int>(std::floor((x + w) / size));
+    if (col0 < 0) col0 = 0;
+    if (col1 > numCols - 1) col1 = numCols - 1;
+}
+
+int TileMap::solidCount() const {
+    int count = 0;
+    int cells = numCols * numRows;
+    for (int i = 0; i < cells; i++) {
+        if (tiles[i] != TILE_EMPTY) count++;
+    }
+    return count;
+}
@@ -0,0 +1,709 @@
+#include "World.h"
+#include <algorithm>
+#include <cmath>
+
+// Kapasitas awal EntityStore; level biasa tidak pernah melewatinya,
+// jadi store tidak realloc di tengah tick
+static const int ENTITY_RESERVE = 256;
+static const int MAX_LOOSE_COINS = 128;
+// Level tanpa ujung: state permanen hanya disimpan untuk chunk sejauh
+// ini di belakang window streaming, supaya memory tidak tumbuh
+// mengikuti jarak tempuh
+static const int ENDLESS_STATE_CHUNKS = 32;
+static const float COIN_SPIN_SPEED = 3.0f;     // Radian per detik
+
+// Box broadphase untuk coin (sama dengan GameScene)
+static SDL_Rect coinBox(int x, int y) {
+    SDL_Rect r = {x - 8, y - 8, 16, 16};
+    return r;
+}
+
+static SDL_Rect enemyBox(const EntityStore& enemies, int i) {
+    SDL_Rect r = {static_cast<int>(enemies.x[i]), static_cast<int>(enemies.y[i]), enemies.width[i], enemies.height[i]};
+    return r;
+}
+
+static bool overlapsX(const SDL_Rect& box, const SDL_Rect& region) {
+    return box.x < region.x + region.w && region.x < box.x + box.w;
+}
+
+World::World()
+    : source(nullptr), size(32), groundTop(0), groundH(0), entityClock(0.0f), nextRevision(0),
+      cellRows(0), forgottenChunk(0), looseCoins(MAX_LOOSE_COINS), looseHead(0), looseCount(0) {
+    streamStats = {0, 0, 0, 0};
+    activation = {0, 0, 0, 0, 0, 0};
+    enemyStore.reserve(ENTITY_RESERVE);
+    coinStore.reserve(ENTITY_RESERVE);
+    activationScratch.reserve(2 * ENTITY_RESERVE);
+}
+
+void World::load(ChunkSource* chunkSource, const StreamingConfig& streamConfig) {
+    clear();
+    source = chunkSource;
+    config = streamConfig;
+    size = source->tileSize();
+    groundH = source->groundHeight();
+    groundTop = source->rows() * size;
+    cellRows = source->rows();
+}
+
+void World::clear() {
+    for (size_t i = 0; i < slots.size(); i++) {
+        if (slots[i].used) evictSlot(static_cast<int>(i));
+    }
+    slots.clear();
+    residentSlot.clear();
+    phase.clear();
+    enemyStore.clear();
+    coinStore.clear();
+    hitBlocks.clear();
+    collectedCoins.clear();
+    defeatedEnemies.clear();
+    residentEnemies.clear();
+    forgottenChunk = 0;
+    looseHead = 0;
+    looseCount = 0;
+    streamStats = {0, 0, 0, 0};
+    activation = {0, 0, 0, 0, 0, 0};
+    entityClock = 0.0f;
+}
+
+// ========================================
+// Streaming
+// ========================================
+
+int World::chunkIndexOf(float x) const {
+    return static_cast<int>(std::floor(x / chunkWidthPixels()));
+}
+
+int World::slotOf(int chunkIndex) const {
+    std::unordered_map<int, int>::const_iterator it = residentSlot.find(chunkIndex);
+    return it == residentSlot.end() ? -1 : it->second;
+}
+
+void World::captureTiles(float x0, float x1, TileView& out) const {
+    if (out.owner != this) {
+        out.chunks.clear();
+        out.owner = this;
+    }
+    out.tileSize = size;
+    out.groundY = groundTop;
+    out.chunkWidth = chunkWidthPixels();
+    out.height = rows() * size;
+    out.chunkCount = 0;
+
+    for (int index = chunkIndexOf(x0); index <= chunkIndexOf(x1); index++) {
+        const LevelChunk* chunk = chunkAt(index);
+        if (!chunk || chunk->cols == 0) continue;
+
+        if (out.chunkCount == out.chunks.size()) out.chunks.emplace_back();
+        LevelChunk& copy = out.chunks[out.chunkCount++];
+        if (copy.index == chunk->index && copy.revision == chunk->revision && copy.cols == chunk->cols) continue;
+
+        // Capacity vector salinan dipakai ulang; coin dan enemy tidak ikut
+        copy.startX = chunk->startX;
+        copy.width = chunk->width;
+        copy.index = chunk->index;
+        copy.cols = chunk->cols;
+        copy.rows = chunk->rows;
+        copy.tiles = chunk->tiles;
+        copy.colliderGrid = chunk->colliderGrid;
+        copy.platforms = chunk->platforms;
+        copy.revision = chunk->revision;
+    }
+}
+
+const LevelChunk* World::chunkAt(int chunkIndex) const {
+    int slot = slotOf(chunkIndex);
+    return slot < 0 ? nullptr : &slots[slot].chunk;
+}
+
+void World::stream(float cameraX, int viewWidth) {
+    if (!source) return;
+
+    int first = chunkIndexOf(cameraX - config.keepBehindPixels);
+    int last = chunkIndexOf(cameraX + viewWidth + config.loadAheadPixels);
+    if (first < 0) first = 0;
+    if (source->widthPixels() >= 0) {
+        int lastChunk = (source->widthPixels() - 1) / chunkWidthPixels();
+        if (last > lastChunk) last = lastChunk;
+    }
+
+    if (source->widthPixels() < 0 && first - ENDLESS_STATE_CHUNKS > forgottenChunk) {
+        forgetBefore(first - ENDLESS_STATE_CHUNKS);
+    }
+
+    // Chunk yang sudah di luar window dilepas
+    for (size_t i = 0; i < slots.size(); i++) {
+        if (!slots[i].used) continue;
+        int index = slots[i].chunk.index;
+        if (index < first || index > last) evictSlot(static_cast<int>(i));
+    }
+
+    // Chunk terdekat dulu, supaya yang di layar siap paling awal
+    wantedChunks.clear();
+    for (int index = first; index <= last; index++) {
+        if (slotOf(index) < 0) wantedChunks.push_back(index);
+    }
+    int cameraChunk = chunkIndexOf(cameraX);
+    std::sort(wantedChunks.begin(), wantedChunks.end(), [cameraChunk](int a, int b) {
+        return std::abs(a - cameraChunk) < std::abs(b - cameraChunk);
+    });
+    // Chunk yang terlihat selalu dibangun; load-ahead hanya selama
+    // masih muat di budget, supaya tidak build-evict tiap frame
+    int firstVisible = chunkIndexOf(cameraX);
+    int lastVisible = chunkIndexOf(cameraX + viewWidth - 1);
+    for (int index : wantedChunks) {
+        bool visible = index >= firstVisible && index <= lastVisible;
+        if (!visible && residentBytes() >= config.memoryBudget) continue;
+        buildChunk(index);
+    }
+
+    enforceBudget(firstVisible, lastVisible, cameraX);
+}
+
+size_t World::residentBytes() const {
+    size_t total = 0;
+    for (const auto& s : slots) total += slotBytes(s);
+    return total;
+}
+
+void World::refreshRange(int x0, int x1) {
+    if (!source || x1 <= x0) return;
+
+    // Jumlah baris bisa berubah (hot reload): ground plane ikut pindah
+    groundH = source->groundHeight();
+    groundTop = source->rows() * size;
+    if (source->rows() != cellRows) remapHitBlocks(source->rows());
+
+    int first = chunkIndexOf(static_cast<float>(x0));
+    int last = chunkIndexOf(static_cast<float>(x1 - 1));
+    for (size_t i = 0; i < slots.size(); i++) {
+        if (!slots[i].used) continue;
+        int index = slots[i].chunk.index;
+        if (index >= first && index <= last) refreshSlot(static_cast<int>(i));
+    }
+}
+
+void World::refreshSlot(int slot) {
+    LevelChunk& fresh = refreshScratch;
+    if (!source->buildChunk(slots[slot].chunk.index, config.chunkCols, fresh)) return;
+    reservePersistent(fresh);
+
+    // Geometry diganti seluruhnya (state hit tetap dari hitBlocks)
+    LevelChunk& chunk = slots[slot].chunk;
+    chunk.cols = fresh.cols;
+    chunk.rows = fresh.rows;
+    chunk.width = fresh.width;
+    std::swap(chunk.tiles, fresh.tiles);
+    std::swap(chunk.colliderGrid, fresh.colliderGrid);
+    std::swap(chunk.platforms, fresh.platforms);
+    applyHitState(chunk);
+    touchChunk(chunk);
+
+    // Coin: yang spawn-nya masih ada dipertahankan (termasuk animasinya),
+    // coin dari '?' selalu dipertahankan, spawn baru ditambahkan
+    int home = chunk.index;
+    for (int i = coinStore.size() - 1; i >= 0; i--) {
+        if (coinStore.chunk[i] != home || coinStore.spawnId[i] < 0) continue;
+
+        // Posisi ikut spawn baru (baris level bisa bergeser)
+        bool kept = false;
+        for (const auto& f : fresh.coins) {
+            if (f.spawnId != coinStore.spawnId[i]) continue;
+            kept = true;
+            coinStore.x[i] = static_cast<float>(f.x);
+            coinStore.y[i] = static_cast<float>(f.y);
+            phase.move(coinStore.proxy[i], coinBox(f.x, f.y));
+        }
+        if (!kept) removeCoin(i);
+    }
+    for (const auto& f : fresh.coins) {
+        if (collectedCoins.test(f.spawnId)) continue;
+
+        bool present = false;
+        for (int i = 0; i < coinStore.size() && !present; i++) {
+            present = coinStore.chunk[i] == home && coinStore.spawnId[i] == f.spawnId;
+        }
+        if (!present) addCoin(f, home);
+    }
+
+    // Enemy: yang spawn point-nya di chunk ini tapi sudah dihapus dari
+    // level dilepas (di chunk mana pun ia sekarang berada)
+    for (int i = enemyStore.size() - 1; i >= 0; i--) {
+        if (enemyStore.homeChunk[i] != home || enemyStore.spawnId[i] < 0) continue;
+
+        // Yang dipertahankan tetap di x-nya, tinggi ikut spawn baru
+        bool removed = true;
+        for (const auto& f : fresh.enemies) {
+            if (f.spawnId != enemyStore.spawnId[i]) continue;
+            removed = false;
+            enemyStore.y[i] = f.y;
+            phase.move(enemyStore.proxy[i], enemyBox(enemyStore, i));
+        }
+        if (removed) {
+            residentEnemies.reset(enemyStore.spawnId[i]);
+            removeEnemy(i);
+        }
+    }
+
+    // Spawn baru (belum pernah hidup dan belum dikalahkan) ditambahkan
+    for (const auto& f : fresh.enemies) {
+        if (residentEnemies.test(f.spawnId) || defeatedEnemies.test(f.spawnId)) continue;
+        addEnemy(f, home);
+    }
+}
+
+int World::acquireSlot() {
+    for (size_t i = 0; i < slots.size(); i++) {
+        if (!slots[i].used) return static_cast<int>(i);
+    }
+    ChunkSlot slot;
+    slot.used = false;
+    slots.push_back(slot);
+    return static_cast<int>(slots.size()) - 1;
+}
+
+bool World::buildChunk(int chunkIndex) {
+    int slot = acquireSlot();
+    ChunkSlot& s = slots[slot];
+    if (!source->buildChunk(chunkIndex, config.chunkCols, s.chunk)) {
+        return false;
+    }
+
+    s.used = true;
+    residentSlot[chunkIndex] = slot;
+    touchChunk(s.chunk);
+    reservePersistent(s.chunk);
+    // Satu cell lebih di tiap sisi: entity di tepi chunk boleh menjorok
+    phase.reserveCells(s.chunk.startX - phase.cellSize(),
+                       s.chunk.startX + s.chunk.width + phase.cellSize());
+    applyPersistentState(slot);
+    registerEntities(slot);
+    streamStats.chunksBuilt++;
+    return true;
+}
+
+void World::applyHitState(LevelChunk& chunk) {
+    for (auto& p : chunk.platforms) {
+        if (p.isBreakable && hitBlocks.test(cellIndex(p.rect.x / size, p.rect.y / size))) {
+            p.isHit = true;
+        }
+    }
+}
+
+void World::reservePersistent(const LevelChunk& chunk) {
+    hitBlocks.reserve((chunk.startX / size + chunk.cols) * cellRows);
+
+    int maxSpawn = -1;
+    for (const auto& c : chunk.coins) maxSpawn = std::max(maxSpawn, c.spawnId);
+    collectedCoins.reserve(maxSpawn + 1);
+    maxSpawn = -1;
+    for (const auto& e : chunk.enemies) maxSpawn = std::max(maxSpawn, e.spawnId);
+    defeatedEnemies.reserve(maxSpawn + 1);
+    residentEnemies.reserve(maxSpawn + 1);
+}
+
+void World::forgetBefore(int chunkIndex) {
+    // Chunk ini dan setelahnya dibangun ulang "bersih" kalau didekati
+    // lagi (respawn di awal level): coin dan '?' muncul kembali, sama
+    // seperti section yang di-generate ulang
+    hitBlocks.discardBelow(chunkIndex * config.chunkCols * cellRows);
+    int spawnFloor = source->spawnIdFloor(chunkIndex);
+    if (spawnFloor >= 0) {
+        collectedCoins.discardBelow(spawnFloor);
+        defeatedEnemies.discardBelow(spawnFloor);
+        residentEnemies.discardBelow(spawnFloor);
+    }
+    forgottenChunk = chunkIndex;
+}
+
+void World::remapHitBlocks(int rows) {
+    // Hanya saat hot reload mengubah jumlah baris: cell yang barisnya
+    // sudah tidak ada dibuang
+    remapScratch.clear();
+    remapScratch.discardBelow(hitBlocks.lowest() / cellRows * rows);
+    for (int index = hitBlocks.lowest(); index < hitBlocks.limit(); index++) {
+        if (!hitBlocks.test(index)) continue;
+        int row = index % cellRows;
+        if (row < rows) remapScratch.set(index / cellRows * rows + row);
+    }
+    std::swap(hitBlocks, remapScratch);
+    cellRows = rows;
+}
+
+void World::applyPersistentState(int slot) {
+    LevelChunk& chunk = slots[slot].chunk;
+    applyHitState(chunk);
+
+    chunk.coins.erase(std::remove_if(chunk.coins.begin(), chunk.coins.end(),
+        [this](const Coin& c) { return collectedCoins.test(c.spawnId); }),
+        chunk.coins.end());
+
+    // Enemy yang sudah mati, atau yang masih hidup tapi sudah pindah ke chunk lain
+    chunk.enemies.erase(std::remove_if(chunk.enemies.begin(), chunk.enemies.end(),
+        [this](const Enemy& e) {
+            return defeatedEnemies.test(e.spawnId) || residentEnemies.test(e.spawnId);
+        }),
+        chunk.enemies.end());
+
+    // Coin dari '?' yang belum diambil waktu chunk-nya di-evict. Yang
+    // diambil diganti entry kepala ring, lalu kepala maju satu.
+    int endX = chunk.startX + chunk.width;
+    for (int k = 0; k < looseCount;) {
+        Coin& loose = looseCoins[(looseHead + k) % MAX_LOOSE_COINS];
+        if (loose.x >= chunk.startX && loose.x < endX) {
+            chunk.coins.push_back(loose);
+            loose = looseCoins[looseHead];
+            looseHead = (looseHead + 1) % MAX_LOOSE_COINS;
+            looseCount--;
+        } else {
+            k++;
+        }
+    }
+}
+
+void World::pushLooseCoin(const Coin& coin) {
+    if (looseCount == MAX_LOOSE_COINS) {
+        looseHead = (looseHead + 1) % MAX_LOOSE_COINS;
+        looseCount--;
+    }
+    looseCoins[(looseHead + looseCount) % MAX_LOOSE_COINS] = coin;
+    looseCount++;
+}
+
+// Spawn dari ChunkSource dipindah ke EntityStore; list spawn di chunk
+// dikosongkan (capacity-nya dipakai lagi saat chunk dibangun ulang)
+void World::registerEntities(int slot) {
+    LevelChunk& chunk = slots[slot].chunk;
+
+    for (const Enemy& e : chunk.enemies) addEnemy(e, chunk.index);
+    for (const Coin& c : chunk.coins) addCoin(c, chunk.index);
+    chunk.enemies.clear();
+    chunk.coins.clear();
+}
+
+void World::addEnemy(const Enemy& spawn, int chunkIndex) {
+    EntityHandle handle = enemyStore.create(spawn.x, spawn.y);
+    int i = enemyStore.indexOf(handle);
+    enemyStore.vx[i] = spawn.vx;
+    enemyStore.width[i] = spawn.rect.w;
+    enemyStore.height[i] = spawn.rect.h;
+    enemyStore.spawnId[i] = spawn.spawnId;
+    enemyStore.chunk[i] = chunkIndex;
+    enemyStore.homeChunk[i] = chunkIndex;
+    enemyStore.proxy[i] = phase.add(enemyBox(enemyStore, i), BP_ENEMY, handle);
+    residentEnemies.set(spawn.spawnId);
+}
+
+void World::addCoin(const Coin& spawn, int chunkIndex) {
+    EntityHandle handle = coinStore.create(static_cast<float>(spawn.x), static_cast<float>(spawn.y));
+    int i = coinStore.indexOf(handle);
+    coinStore.animPhase[i] = spawn.animPhase;
+    coinStore.spawnId[i] = spawn.spawnId;
+    coinStore.chunk[i] = chunkIndex;
+    coinStore.homeChunk[i] = chunkIndex;
+    coinStore.proxy[i] = phase.add(coinBox(spawn.x, spawn.y), BP_COIN, handle);
+}
+
+void World::removeEnemy(int index) {
+    if (enemyStore.proxy[index] >= 0) phase.remove(enemyStore.proxy[index]);
+    enemyStore.destroy(enemyStore.handles[index]);
+}
+
+void World::removeCoin(int index) {
+    if (coinStore.proxy[index] >= 0) phase.remove(coinStore.proxy[index]);
+    coinStore.destroy(coinStore.handles[index]);
+}
+
+void World::evictSlot(int slot) {
+    int index = slots[slot].chunk.index;
+
+    // Dari belakang: swap-remove hanya memindahkan entity yang sudah dicek.
+    // Enemy yang masih hidup akan muncul lagi dari spawn point-nya.
+    for (int i = enemyStore.size() - 1; i >= 0; i--) {
+        if (enemyStore.chunk[i] != index) continue;
+        residentEnemies.reset(enemyStore.spawnId[i]);
+        removeEnemy(i);
+    }
+    for (int i = coinStore.size() - 1; i >= 0; i--) {
+        if (coinStore.chunk[i] != index) continue;
+        if (coinStore.spawnId[i] < 0) {
+            Coin loose = {static_cast<int>(coinStore.x[i]), static_cast<int>(coinStore.y[i]),
+                          false, coinStore.animPhase[i], -1};
+            pushLooseCoin(loose);
+        }
+        removeCoin(i);
+    }
+
+    // Cell tepi yang masih bertetangga dengan chunk resident dibiarkan;
+    // cell tepi chunk tetangga yang sudah tidak resident ikut dilepas
+    const LevelChunk& chunk = slots[slot].chunk;
+    int margin = phase.cellSize();
+    int x0 = chunk.startX + (slotOf(index - 1) >= 0 ? margin : -margin);
+    int x1 = chunk.startX + chunk.width + (slotOf(index + 1) >= 0 ? -margin : margin);
+    phase.releaseCells(x0, x1);
+    releaseSlot(slot);
+    streamStats.chunksEvicted++;
+}
+
+void World::releaseSlot(int slot) {
+    ChunkSlot& s = slots[slot];
+    residentSlot.erase(s.chunk.index);
+    s.used = false;
+    // Vector tidak di-free supaya slot bisa dipakai ulang tanpa alokasi
+    s.chunk.platforms.clear();
+    s.chunk.coins.clear();
+    s.chunk.enemies.clear();
+}
+
+size_t World::slotBytes(const ChunkSlot& s) const {
+    const LevelChunk& c = s.chunk;
+    return sizeof(ChunkSlot)
+         + c.platforms.capacity() * sizeof(Platform)
+         + c.coins.capacity() * sizeof(Coin)
+         + c.enemies.capacity() * sizeof(Enemy)
+         + c.tiles.capacity() * sizeof(Uint8)
+         + c.colliderGrid.capacity() * sizeof(Uint16);
+}
+
+void World::enforceBudget(int firstVisible, int lastVisible, float cameraX) {
+    size_t total = residentBytes();
+
+    // Slot kosong dilepas dulu sebelum evict chunk yang masih dipakai
+    for (size_t i = 0; i < slots.size() && total > config.memoryBudget; i++) {
+        if (slots[i].used) continue;
+        total -= slotBytes(slots[i]);
+        LevelChunk empty;
+        std::swap(slots[i].chunk, empty);
+        total += slotBytes(slots[i]);
+    }
+
+    // Lalu chunk terjauh dari kamera, kecuali yang sedang terlihat
+    while (total > config.memoryBudget) {
+        int victim = -1;
+        float victimDistance = -1.0f;
+        for (size_t i = 0; i < slots.size(); i++) {
+            if (!slots[i].used) continue;
+            int index = slots[i].chunk.index;
+            if (index >= firstVisible && index <= lastVisible) continue;
+
+            float center = slots[i].chunk.startX + slots[i].chunk.width * 0.5f;
+            float distance = std::abs(center - cameraX);
+            if (distance > victimDistance) {
+                victimDistance = distance;
+                victim = static_cast<int>(i);
+            }
+        }
+        if (victim < 0) break;
+
+        evictSlot(victim);
+        total -= slotBytes(slots[victim]);
+        LevelChunk empty;
+        std::swap(slots[victim].chunk, empty);
+        total += slotBytes(slots[victim]);
+    }
+
+    int resident = 0;
+    for (const auto& s : slots) {
+        if (s.used) resident++;
+    }
+    streamStats.residentChunks = resident;
+    streamStats.residentBytes = total;
+}
+
+// ========================================
+// Geometry
+// ========================================
+
+SDL_Rect World::groundRect(float fromX, float width) const {
+    int x0 = static_cast<int>(std::floor(fromX));
+    int x1 = static_cast<int>(std::ceil(fromX + width));
+    if (source && source->widthPixels() >= 0) {
+        if (x0 < 0) x0 = 0;
+        if (x1 > source->widthPixels()) x1 = source->widthPixels();
+    }
+    SDL_Rect r = {x0, groundTop, std::max(x1 - x0, 0), groundH};
+    return r;
+}
+
+void World::collidersInArea(float x, float y, float w, float h, std::vector<ColliderRef>& out) const {
+    out.clear();
+
+    int chunk0 = chunkIndexOf(x);
+    int chunk1 = chunkIndexOf(x + w);
+    int row0 = static_cast<int>(std::floor(y / size));
+    int row1 = static_cast<int>(std::floor((y + h) / size));
+
+    for (int index = chunk0; index <= chunk1; index++) {
+        int slot = slotOf(index);
+        if (slot < 0) continue;
+        const LevelChunk& chunk = slots[slot].chunk;
+
+        int col0 = static_cast<int>(std::floor((x - chunk.startX) / size));
+        int col1 = static_cast<int>(std::floor((x + w - chunk.startX) / size));
+        col0 = std::max(col0, 0);
+        col1 = std::min(col1, chunk.cols - 1);
+        int r0 = std::max(row0, 0);
+        int r1 = std::min(row1, chunk.rows - 1);
+
+        size_t begin = out.size();
+        for (int row = r0; row <= r1; row++) {
+            for (int col = col0; col <= col1; col++) {
+                Uint16 collider = chunk.colliderGrid[row * chunk.cols + col];
+                if (collider == CHUNK_NO_COLLIDER) continue;
+
+                ColliderRef ref = {slot, collider};
+                out.push_back(ref);
+            }
+        }
+
+        // Collider hasil merge menempati banyak cell, cukup sekali
+        std::sort(out.begin() + begin, out.end(),
+                  [](const ColliderRef& a, const ColliderRef& b) { return a.index < b.index; });
+        out.erase(std::unique(out.begin() + begin, out.end(),
+                  [](const ColliderRef& a, const ColliderRef& b) { return a.index == b.index; }),
+                  out.end());
+    }
+}
+
+void World::hitBlock(Platform& block) {
+    block.isHit = true;
+    hitBlocks.set(cellIndex(block.rect.x / size, block.rect.y / size));
+
+    // '?' jadi block bekas: texture chunk-nya harus digambar ulang
+    int slot = slotOf(chunkIndexOf(static_cast<float>(block.rect.x)));
+    if (slot >= 0) touchChunk(slots[slot].chunk);
+}
+
+// ========================================
+// Entity
+// ========================================
+
+void World::collectCoin(EntityHandle coin) {
+    int i = coinStore.indexOf(coin);
+    if (i < 0) return;
+    collectedCoins.set(coinStore.spawnId[i]);
+    removeCoin(i);
+}
+
+void World::killEnemy(EntityHandle enemy) {
+    int i = enemyStore.indexOf(enemy);
+    if (i < 0) return;
+    if (enemyStore.spawnId[i] >= 0) {
+        defeatedEnemies.set(enemyStore.spawnId[i]);
+        residentEnemies.reset(enemyStore.spawnId[i]);
+    }
+    removeEnemy(i);
+}
+
+void World::spawnCoin(int x, int y) {
+    int index = chunkIndexOf(static_cast<float>(x));
+    if (slotOf(index) < 0) return;
+
+    Coin coin = {x, y, false, 0.0f, -1};
+    addCoin(coin, index);
+}
+
+// Tidur (cek X box) dan bangun (query broadphase) memakai box yang
+// sama, jadi entity di tepi region tidak bolak-balik tiap tick
+void World::sleepOutside(EntityStore& store, bool enemies, const SDL_Rect& region) {
+    for (int i = store.awakeCount() - 1; i >= 0; i--) {
+        SDL_Rect box = enemies ? enemyBox(store, i)
+                               : coinBox(static_cast<int>(store.x[i]), static_cast<int>(store.y[i]));
+        if (overlapsX(box, region)) continue;
+
+        store.sleptAt[i] = entityClock;
+        store.sleep(i);
+        activation.sleeps++;
+    }
+}
+
+void World::updateActivation(float cameraX, int viewWidth) {
+    int margin = config.activeMarginPixels;
+    int levelHeight = groundTop + groundH;
+    SDL_Rect region = {static_cast<int>(std::floor(cameraX)) - margin, -levelHeight,
+                       viewWidth + 2 * margin, 3 * levelHeight};
+
+    // Yang aktif tapi sudah keluar region: O(entity aktif)
+    sleepOutside(enemyStore, true, region);
+    sleepOutside(coinStore, false, region);
+
+    // Yang tidur di dalam region diambil dari broadphase, jadi biayanya
+    // mengikuti isi region, bukan jumlah entity yang tidur
+    phase.query(region, bpMask(BP_ENEMY) | bpMask(BP_COIN), activationScratch);
+    for (int id : activationScratch) {
+        const BroadphaseProxy& p = phase.proxy(id);
+        bool enemy = p.layer == BP_ENEMY;
+        EntityStore& store = enemy ? enemyStore : coinStore;
+        int i = store.indexOf(p.user);
+        if (i < 0 || store.isAwake(i)) continue;
+
+        if (enemy) {
+            // Lanjut dari posisi saat tidur, tanpa interpolasi dari tick lama
+            store.prevX[i] = store.x[i];
+        } else {
+            store.animPhase[i] += (entityClock - store.sleptAt[i]) * COIN_SPIN_SPEED;
+        }
+        store.wake(i);
+        activation.wakes++;
+    }
+
+    activation.awakeEnemies = enemyStore.awakeCount();
+    activation.sleepingEnemies = enemyStore.size() - enemyStore.awakeCount();
+    activation.awakeCoins = coinStore.awakeCount();
+    activation.sleepingCoins = coinStore.size() - coinStore.awakeCount();
+}
+
+void World::updateEnemies(float deltaTime) {
+    int levelWidth = widthPixels();
+    EntityStore& e = enemyStore;
+    int count = e.awakeCount();
+
+    for (int i = 0; i < count; i++) {
+        e.prevX[i] = e.x[i];
+        e.x[i] += e.vx[i] * deltaTime;
+
+        // Bounce off level edges
+        if (e.x[i] < 0 || (levelWidth >= 0 && e.x[i] > levelWidth - e.width[i])) {
+            e.vx[i] = -e.vx[i];
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        phase.move(e.proxy[i], enemyBox(e, i));
+    }
+
+    // Enemy yang titik tengahnya sudah lewat batas pindah ke chunk tetangga.
+    // Dari belakang supaya swap-remove tidak melewatkan enemy.
+    for (int i = count - 1; i >= 0; i--) {
+        int owner = chunkIndexOf(e.x[i] + e.width[i] * 0.5f);
+        if (owner == e.chunk[i]) continue;
+
+        if (slotOf(owner) >= 0) {
+            e.chunk[i] = owner;
+        } else {
+            // Chunk tujuan belum resident - enemy dilepas dan muncul
+            // lagi dari spawn point saat chunk asalnya dibangun ulang
+            residentEnemies.reset(e.spawnId[i]);
+            removeEnemy(i);
+        }
+    }
+}
+
+void World::updateCoins(float deltaTime) {
+    entityClock += deltaTime;
+
+    std::vector<float>& phases = coinStore.animPhase;
+    int count = coinStore.awakeCount();
+    for (int i = 0; i < count; i++) {
+        phases[i] += deltaTime * COIN_SPIN_SPEED;
+    }
+}
+
+int World::activeEnemyCount() const {
+    return enemyStore.size();
+}
+
+int World::coinCount() const {
+    return coinStore.size();
+}
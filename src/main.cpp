@@ -1,13 +1,31 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
 #include <iostream>
+#include <string>
 #include "Menu.h"
 #include "GameBox.h"
+#include "GameScene.h"
+#include "RenderQueue.h"
+#include "RenderCanvas.h"
+#include "FramePacer.h"
+
+// Batas fps (--fps): -1 = refresh rate display, 0 = tanpa batas
+static int frameCap = -1;
+
+// Idle: tanpa input selama MENU_IDLE_DELAY di menu (atau window tidak
+// fokus) animasi turun ke IDLE_FPS; window tersembunyi tidak digambar
+const Uint32 MENU_IDLE_DELAY = 3000;
+const int IDLE_FPS = 10;
+const int HIDDEN_WAIT_MS = 500;
 
 class Game {
 public:
     Game() : window(nullptr), renderer(nullptr), running(true), 
-             state(MENU), fullscreen(false), lastFrameTime(0) {}
+             state(MENU), fullscreen(false), lastFrameCounter(0), vsyncReported(false),
+             windowVisible(true), windowFocused(true), lastInputTime(0) {}
     
     ~Game() {
         cleanup();
@@ -64,73 +82,167 @@ public:
         renderer = SDL_CreateRenderer(window, -1, 
             SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
         
+        // Tanpa GPU: renderer software SDL + rasterizer sendiri
+        if (!renderer) {
+            std::cerr << "Accelerated renderer unavailable, using software: " << SDL_GetError() << std::endl;
+            renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+            softwareRendering = true;
+        }
+        
         if (!renderer) {
             std::cerr << "SDL_CreateRenderer Error: " << SDL_GetError() << std::endl;
             return false;
         }
         
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        renderQueue.init(renderer);
         
         // Get actual window size
         SDL_GetWindowSize(window, &windowWidth, &windowHeight);
         
+        // Menu digambar di canvas logical, sama seperti game
+        canvas.init(renderer, canvasScale);
+        renderQueue.setSoftware(canvas.software());
+        
         // Initialize menu
-        if (!menu.init(windowWidth, windowHeight)) {
+        if (!menu.init(canvas.width(), canvas.height())) {
             std::cerr << "Menu initialization failed" << std::endl;
             return false;
         }
         
-        lastFrameTime = SDL_GetTicks();
+        // Gameplay disiapkan sekali; masuk dari menu tidak memuat apa pun
+        if (!gameScene.init(renderer, canvas.width(), canvas.height())) {
+            std::cerr << "[!] Level failed to load, game unavailable" << std::endl;
+        }
+        
+        // Vsync dari flag renderer hanya permintaan; pacer mengukur sendiri
+        SDL_RendererInfo info;
+        bool vsyncRequested = SDL_GetRendererInfo(renderer, &info) == 0 &&
+                              (info.flags & SDL_RENDERER_PRESENTVSYNC) != 0;
+        SDL_DisplayMode mode;
+        int refreshRate = SDL_GetWindowDisplayMode(window, &mode) == 0 ? mode.refresh_rate : 0;
+        pacer.setVsync(vsyncRequested, refreshRate);
+        pacer.setTargetFps(frameCap >= 0 ? frameCap : (refreshRate > 0 ? refreshRate : 60));
+        
+        lastFrameCounter = SDL_GetPerformanceCounter();
+        lastInputTime = SDL_GetTicks();
         
         std::cout << "========================================" << std::endl;
         std::cout << "Super Gamw Bros" << std::endl;
         std::cout << "========================================" << std::endl;
         std::cout << "Window: " << windowWidth << "x" << windowHeight << std::endl;
+        std::cout << "Canvas: " << canvas.width() << "x" << canvas.height() << std::endl;
+        if (canvas.software()) {
+            std::cout << "Software renderer: " << canvas.software()->threadCount() << " threads" << std::endl;
+        }
         std::cout << "Video Driver: " << SDL_GetCurrentVideoDriver() << std::endl;
+        std::cout << "Frame cap: ";
+        if (pacer.targetFps() > 0) std::cout << pacer.targetFps() << " fps" << std::endl;
+        else std::cout << "uncapped" << std::endl;
         std::cout << "========================================" << std::endl;
         
         return true;
     }
     
     void run() {
-        const int TARGET_FPS = 60;
-        const int FRAME_DELAY = 1000 / TARGET_FPS;
-        
-        Uint32 frameStart;
-        int frameTime;
-        
         while (running) {
-            frameStart = SDL_GetTicks();
+            // Minimize / tersembunyi: tidur sampai ada event, tidak ada render
+            if (!windowVisible) {
+                SDL_WaitEventTimeout(nullptr, HIDDEN_WAIT_MS);
+                handleEvents();
+                lastFrameCounter = SDL_GetPerformanceCounter();
+                pacer.idle();
+                continue;
+            }
             
             handleEvents();
             update();
             render();
             
-            frameTime = SDL_GetTicks() - frameStart;
+            // Satu-satunya tempat frame ditahan (lihat FramePacer.h).
+            // Idle: tunggu event dengan timeout, input langsung membangunkan loop
+            if (idle()) {
+                SDL_WaitEventTimeout(nullptr, 1000 / IDLE_FPS);
+                pacer.idle();
+            } else {
+                pacer.wait();
+            }
             
-            if (FRAME_DELAY > frameTime) {
-                SDL_Delay(FRAME_DELAY - frameTime);
+            // Diukur ulang kalau interval present berubah: laporkan lagi
+            if (!pacer.vsyncMeasured()) {
+                vsyncReported = false;
+            } else if (!vsyncReported) {
+                vsyncReported = true;
+                std::cout << "VSync: " << (pacer.vsyncActive() ? "active" : "not active, paced by timer") << std::endl;
             }
         }
+        
+        FrameTimeStats fs = pacer.stats();
+        if (fs.frames > 0) {
+            std::cout << "Frame time (last " << fs.frames << " frames): mean " << fs.meanMs
+                      << " ms, stddev " << fs.stddevMs << " ms, p99 " << fs.p99Ms
+                      << " ms, max " << fs.maxMs << " ms" << std::endl;
+        }
     }
     
 private:
     SDL_Window* window;
     SDL_Renderer* renderer;
     Menu menu;
+    GameScene gameScene;
+    RenderQueue renderQueue;
+    RenderCanvas canvas;
     bool running;
     GameState state;
     bool fullscreen;
     int windowWidth;
     int windowHeight;
-    Uint32 lastFrameTime;
+    Uint64 lastFrameCounter;
+    FramePacer pacer;
+    bool vsyncReported;
+    bool windowVisible;
+    bool windowFocused;
+    Uint32 lastInputTime;
+    
+    // Game tidak fokus = pause; menu idle setelah beberapa detik tanpa input
+    bool idle() const {
+        if (!windowFocused) return true;
+        return state != PLAYING && SDL_GetTicks() - lastInputTime > MENU_IDLE_DELAY;
+    }
     
     void handleEvents() {
         SDL_Event e;
         while (SDL_PollEvent(&e)) {
+            // Event apa pun mengembalikan loop ke frame rate penuh
+            lastInputTime = SDL_GetTicks();
+            
             if (e.type == SDL_QUIT) {
                 running = false;
             }
+            else if (e.type == SDL_WINDOWEVENT) {
+                switch (e.window.event) {
+                    case SDL_WINDOWEVENT_HIDDEN:
+                    case SDL_WINDOWEVENT_MINIMIZED:
+                        windowVisible = false;
+                        break;
+                    case SDL_WINDOWEVENT_SHOWN:
+                    case SDL_WINDOWEVENT_EXPOSED:
+                    case SDL_WINDOWEVENT_RESTORED:
+                    case SDL_WINDOWEVENT_MAXIMIZED:
+                        windowVisible = true;
+                        break;
+                    case SDL_WINDOWEVENT_FOCUS_GAINED:
+                        windowFocused = true;
+                        break;
+                    case SDL_WINDOWEVENT_FOCUS_LOST:
+                        windowFocused = false;
+                        break;
+                }
+            }
+            else if (e.type == SDL_RENDER_TARGETS_RESET || e.type == SDL_RENDER_DEVICE_RESET) {
+                // Scene yang tidak aktif juga kehilangan isi texture-nya
+                gameScene.invalidateCache();
+            }
             else if (e.type == SDL_KEYDOWN) {
                 // Global hotkeys
                 if (e.key.keysym.sym == SDLK_F11) {
@@ -146,25 +258,46 @@ private:
                 }
             }
             
-            // Pass events to menu
+            // Koordinat mouse dari window ke canvas
+            if (e.type == SDL_MOUSEMOTION) {
+                SDL_Point p = canvas.toLogical(e.motion.x, e.motion.y);
+                e.motion.x = p.x;
+                e.motion.y = p.y;
+            } else if (e.type == SDL_MOUSEBUTTONDOWN || e.type == SDL_MOUSEBUTTONUP) {
+                SDL_Point p = canvas.toLogical(e.button.x, e.button.y);
+                e.button.x = p.x;
+                e.button.y = p.y;
+            }
+            
+            // Pass events to the active scene
             if (state == MENU) {
                 menu.handleEvent(e, state, running);
             }
+            else if (state == PLAYING) {
+                gameScene.handleEvent(e);
+            }
         }
     }
     
     void update() {
-        Uint32 currentTime = SDL_GetTicks();
-        float deltaTime = (currentTime - lastFrameTime) / 1000.0f;
-        lastFrameTime = currentTime;
+        Uint64 counter = SDL_GetPerformanceCounter();
+        float deltaTime = static_cast<float>(counter - lastFrameCounter) / SDL_GetPerformanceFrequency();
+        lastFrameCounter = counter;
+        
+        // Pause: waktu selama window tidak fokus tidak disimulasikan.
+        // Thread simulasi ikut berhenti selama menu atau window tidak fokus
+        gameScene.setPaused(state != PLAYING || !windowFocused);
+        if (state == PLAYING && !windowFocused) return;
         
         if (state == MENU) {
             menu.update(deltaTime);
         }
         else if (state == PLAYING) {
-            if (!runGameBox(renderer)) {
-                state = MENU; 
-                std::cout << "[*] Returning from game to menu" << std::endl;
+            if (!gameScene.ready()) {
+                state = MENU;
+                std::cout << "[!] No level loaded, returning to menu" << std::endl;
+            } else {
+                gameScene.update();
             }
         }
         else if (state == SETTINGS) {
@@ -173,30 +306,29 @@ private:
     }
     
     void render() {
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        SDL_RenderClear(renderer);
+        canvas.begin();
+        canvas.clear(SDL_Color{0, 0, 0, 255});
         
         if (state == MENU) {
-            menu.render(renderer);
+            menu.render(renderQueue);
         }
         else if (state == PLAYING) {
-            // Game rendering is handled in runGameBox
+            gameScene.render(renderQueue);
         }
         else if (state == SETTINGS) {
             renderSettings();
         }
         
-        SDL_RenderPresent(renderer);
+        renderQueue.flush();
+        canvas.present();
     }
     
     void renderSettings() {
         // Placeholder for settings screen
-        SDL_SetRenderDrawColor(renderer, 60, 40, 20, 255);
-        SDL_RenderClear(renderer);
+        canvas.clear(SDL_Color{60, 40, 20, 255});
         
-        SDL_SetRenderDrawColor(renderer, 255, 200, 150, 255);
-        SDL_Rect rect = {windowWidth/2 - 150, windowHeight/2 - 50, 300, 100};
-        SDL_RenderFillRect(renderer, &rect);
+        SDL_Rect rect = {canvas.width()/2 - 150, canvas.height()/2 - 50, 300, 100};
+        renderQueue.fillRect(0, rect, SDL_Color{255, 200, 150, 255});
     }
     
     void toggleFullscreen() {
@@ -215,12 +347,18 @@ private:
             std::cout << "[*] Windowed mode: " << windowWidth << "x" << windowHeight << std::endl;
         }
         
-        // Reinitialize menu with new dimensions
-        menu.init(windowWidth, windowHeight);
+        // Reinitialize menu with new dimensions (canvas tetap kecuali mode native)
+        canvas.init(renderer, canvasScale);
+        renderQueue.setSoftware(canvas.software());
+        menu.init(canvas.width(), canvas.height());
+        gameScene.resize(canvas.width(), canvas.height());
     }
     
     void cleanup() {
         menu.cleanup();
+        gameScene.cleanup();
+        renderQueue.clear();  // Texture sementara harus dilepas sebelum renderer
+        canvas.release();
         
         if (renderer) {
             SDL_DestroyRenderer(renderer);
@@ -242,6 +380,44 @@ private:
 int main(int argc, char* argv[]) {
     std::cout << "Starting Super Gamw Bros..." << std::endl;
     
+    // --endless          : level endless dengan seed acak
+    // --seed <angka>     : level endless dengan seed tertentu (bisa diulang)
+    // --watch <file.txt> : main level teks dan reload otomatis saat file disimpan
+    // --scale <mode>     : fit (default), integer, atau native (tanpa canvas logical)
+    // --software         : rasterize frame di CPU (multi-thread), untuk mesin tanpa GPU
+    // --fps <n>          : batas fps, 0 = tanpa batas (default: refresh rate display)
+    // --active-margin <px>: enemy/coin lebih jauh dari ini di luar layar tidur (default 256)
+    bool seeded = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--endless") {
+            endlessMode = true;
+        } else if (arg == "--seed" && i + 1 < argc) {
+            endlessMode = true;
+            seeded = true;
+            endlessSeed = static_cast<Uint32>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--watch" && i + 1 < argc) {
+            watchLevelPath = argv[++i];
+        } else if (arg == "--scale" && i + 1 < argc) {
+            std::string mode = argv[++i];
+            if (mode == "integer") canvasScale = CANVAS_INTEGER;
+            else if (mode == "native") canvasScale = CANVAS_NATIVE;
+            else canvasScale = CANVAS_FIT;
+        } else if (arg == "--software") {
+            softwareRendering = true;
+        } else if (arg == "--fps" && i + 1 < argc) {
+            frameCap = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--active-margin" && i + 1 < argc) {
+            activationMargin = std::max(0, std::atoi(argv[++i]));
+        }
+    }
+    if (endlessMode && !seeded) {
+        endlessSeed = static_cast<Uint32>(std::time(nullptr));
+    }
+    if (endlessMode) {
+        std::cout << "Endless mode, seed: " << endlessSeed << std::endl;
+    }
+    
     Game game;
     
     if (!game.init()) {
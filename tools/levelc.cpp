@@ -0,0 +1,56 @@
+// levelc - compile level ASCII (.txt) menjadi level binary (.lvl)
+//
+// Usage: levelc <input.txt> <output.lvl>
+
+#include "LevelCompiler.h"
+#include "LevelFormat.h"
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static const int TILE_SIZE = 32;
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <input.txt> <output.lvl>" << std::endl;
+        return 2;
+    }
+
+    std::ifstream in(argv[1]);
+    if (!in) {
+        std::cerr << "levelc: cannot open " << argv[1] << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> rows;
+    std::string line;
+    while (std::getline(in, line)) {
+        // File dari Windows
+        if (!line.empty() && line[line.size() - 1] == '\r') {
+            line.erase(line.size() - 1);
+        }
+        rows.push_back(line);
+    }
+
+    std::vector<uint8_t> image;
+    std::string error;
+    if (!compileLevel(rows, TILE_SIZE, image, error)) {
+        std::cerr << argv[1] << ": " << error << std::endl;
+        return 1;
+    }
+
+    std::ofstream out(argv[2], std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(&image[0]), static_cast<std::streamsize>(image.size()));
+    if (!out) {
+        std::cerr << "levelc: cannot write " << argv[2] << std::endl;
+        return 1;
+    }
+
+    const LevelFileHeader* header = reinterpret_cast<const LevelFileHeader*>(&image[0]);
+    std::cout << argv[2] << ": " << header->cols << "x" << header->rows << " tiles, "
+              << header->colliderCount << " colliders, "
+              << header->coinCount << " coins, " << header->enemyCount << " enemies, "
+              << image.size() << " bytes (v" << header->version << ")" << std::endl;
+    return 0;
+}